@@ -44,10 +44,10 @@ ASTNode::ASTNode(NodeType t, Location loc) : span(Span(loc, loc)), type(t), valu
 ASTNode::ASTNode(NodeType t, Span s) : span(s), type(t), value(0UL){
 }
 
-inline std::string_view ASTNode::value_as_string(){
-    return std::get<const std::string_view>(value);
+std::string_view ASTNode::value_as_string(){
+    return std::get<std::string_view>(value);
 }
-inline unsigned long ASTNode::value_as_long() const noexcept{
+unsigned long ASTNode::value_as_long() const noexcept{
     return std::get<unsigned long>(value);
 }
 ASTNode_wp ASTNode::value_as_node() const{
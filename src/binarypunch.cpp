@@ -0,0 +1,188 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "binarypunch.hpp"
+
+namespace elsix{
+
+namespace{
+
+struct PunchPatterns{
+    std::array<std::uint16_t, 64> patterns;
+
+    constexpr PunchPatterns(): patterns{}{
+        for(unsigned code = 0; code < 64; code++){
+            patterns[code] = punch_pattern(static_cast<std::uint8_t>(code));
+        }
+    }
+};
+
+constexpr PunchPatterns PUNCH_PATTERNS{};
+
+} // end anonymous namespace
+
+BinaryPunch::BinaryPunch(CardFormat format)
+    : format_(CardFormat::COLUMN_BINARY == format ? format : CardFormat::CODES),
+      record_bytes_(record_bytes(format_)){}
+
+BinaryPunch::~BinaryPunch(){
+    close();
+}
+
+bool BinaryPunch::open(const char *path){
+    int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    return fd >= 0 && open_descriptor(fd);
+}
+
+bool BinaryPunch::open_descriptor(int fd){
+    close();
+    fd_ = fd;
+    failed_ = false;
+    used_ = 0;
+    cards_ = 0;
+    column_ = 0;
+    if(!reserve_card_()){
+        close();
+        return false;
+    }
+
+    CardDeckHeader header{CARD_DECK_MAGIC, CARD_DECK_VERSION, format_, 0, record_bytes_};
+    std::memcpy(spool_, &header, sizeof(header));
+    used_ = sizeof(header);
+    return true;
+}
+
+void BinaryPunch::write(Word characters, unsigned count) noexcept{
+    if(failed_ || fd_ < 0){
+        return;
+    }
+    count = std::min(count, CHARACTERS_PER_WORD);
+    for(unsigned i = count; i > 0; i--){
+        auto code = static_cast<std::uint8_t>((characters >> ((i - 1) * CHARACTER_BITS))
+                                              & CHARACTER_MASK);
+        if(END_OF_LINE_CODE == code){
+            finish_card_();
+            continue;
+        }
+        if(CARD_COLUMNS == column_){
+            finish_card_();
+        }
+        punch_(column_++, code);
+    }
+}
+
+void BinaryPunch::end_line() noexcept{
+    if(fd_ >= 0){
+        finish_card_();
+    }
+}
+
+bool BinaryPunch::close() noexcept{
+    if(fd_ < 0){
+        return !failed_;
+    }
+    if(column_ > 0){
+        finish_card_();
+    }
+    unmap_();
+    if(0 != ftruncate(fd_, static_cast<off_t>(used_))){
+        failed_ = true;
+    }
+    if(0 != ::close(fd_)){
+        failed_ = true;
+    }
+    fd_ = -1;
+    return !failed_;
+}
+
+void BinaryPunch::punch_(unsigned column, std::uint8_t code) noexcept{
+    char *record = spool_ + used_;
+    if(CardFormat::CODES == format_){
+        record[column] = static_cast<char>(code);
+    } else{
+        std::uint16_t pattern = PUNCH_PATTERNS.patterns[code];
+        record[2 * column] = static_cast<char>(pattern & 0xff);
+        record[2 * column + 1] = static_cast<char>(pattern >> 8);
+    }
+}
+
+void BinaryPunch::finish_card_() noexcept{
+    if(failed_){
+        return;
+    }
+    while(column_ < CARD_COLUMNS){
+        punch_(column_++, characters_->blank);
+    }
+    used_ += record_bytes_;
+    cards_++;
+    column_ = 0;
+    static_cast<void>(reserve_card_());
+}
+
+bool BinaryPunch::reserve_card_() noexcept{
+    if(failed_){
+        return false;
+    }
+    if(nullptr != spool_ && used_ + record_bytes_ <= capacity_){
+        return true;
+    }
+
+    std::size_t capacity = std::max(INITIAL_SPOOL_BYTES, 2 * capacity_);
+    // Reserving the blocks now means the disk cannot fill up under the mapping.
+    if(0 != posix_fallocate(fd_, 0, static_cast<off_t>(capacity))){
+        failed_ = true;
+        return false;
+    }
+    unmap_();
+    void *spool = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if(MAP_FAILED == spool){
+        failed_ = true;
+        return false;
+    }
+    spool_ = static_cast<char *>(spool);
+    capacity_ = capacity;
+    return true;
+}
+
+void BinaryPunch::unmap_() noexcept{
+    if(nullptr != spool_){
+        munmap(spool_, capacity_);
+        spool_ = nullptr;
+        capacity_ = 0;
+    }
+}
+
+} // end namespace elsix
@@ -0,0 +1,122 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Punch output in the binary deck format of cardformat.hpp.
+ *
+ * Cards are punched straight into a spool file mapped into memory: each column is stored once, in
+ * its final form, and the kernel writes the pages back on its own schedule. The file is extended
+ * in large steps with space reserved up front, so a full disk is reported as a failed extension
+ * rather than as a fault on a write to the mapping. On `close()` the file is cut back to the
+ * cards punched, and it can then be opened as an input deck.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "field.hpp"
+#include "charset.hpp"
+#include "cardformat.hpp"
+
+namespace elsix{
+
+class BinaryPunch{
+public:
+    /// The spool starts at this size and doubles as it fills.
+    static constexpr std::size_t INITIAL_SPOOL_BYTES = std::size_t{1} << 20;
+
+    explicit BinaryPunch(CardFormat format = CardFormat::CODES);
+    ~BinaryPunch();
+    BinaryPunch(const BinaryPunch &) = delete;
+    BinaryPunch &operator=(const BinaryPunch &) = delete;
+
+    /// Creates or replaces the deck at `path`. Returns false if it cannot be created.
+    bool open(const char *path);
+
+    /// Punches into the regular file open for reading and writing on `fd`, replacing what it
+    /// holds, and takes ownership of the descriptor. Returns false if it cannot be mapped.
+    bool open_descriptor(int fd);
+
+    /**
+     * @brief Implements `(cd, PU, co)` and `(cd, PUH, h)`: punches the low order `count`
+     * characters of `characters`, at most ten. The code 77 (octal) ends the card, as does
+     * reaching the last column.
+     */
+    void write(Word characters, unsigned count) noexcept;
+
+    /// Ends the current card, which may be blank.
+    void end_line() noexcept;
+
+    /**
+     * @brief Ends any partly punched card, cuts the file back to the cards punched, and closes
+     * it. Called on `DONE` and on exit.
+     * @return False if punching failed at any point.
+     */
+    bool close() noexcept;
+
+    /// The number of cards finished so far.
+    [[nodiscard]] std::size_t cards() const noexcept{
+        return cards_;
+    }
+
+    /// Did extending the spool fail? Cards punched afterward are lost.
+    [[nodiscard]] bool failed() const noexcept{
+        return failed_;
+    }
+
+    void set_character_set(const CharacterSet &characters) noexcept{
+        characters_ = &characters;
+    }
+
+private:
+    CardFormat format_;
+    unsigned record_bytes_;
+    int fd_ = -1;
+    char *spool_ = nullptr;
+    std::size_t capacity_ = 0;
+    // The bytes in use: the header and the finished cards.
+    std::size_t used_ = 0;
+    std::size_t cards_ = 0;
+    // The next column of the current card, which begins at `spool_ + used_`.
+    unsigned column_ = 0;
+    bool failed_ = false;
+
+    const CharacterSet *characters_ = &DEFAULT_CHARACTERS;
+
+    void punch_(unsigned column, std::uint8_t code) noexcept;
+    void finish_card_() noexcept;
+    /// Ensures there is room for the current card.
+    [[nodiscard]] bool reserve_card_() noexcept;
+    void unmap_() noexcept;
+};
+
+} // end namespace elsix
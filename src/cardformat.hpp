@@ -0,0 +1,122 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The binary deck format, in which Punch can write cards and from which Input can read
+ * them.
+ *
+ * A binary deck is a 16 byte header followed by fixed length records, one per card. In the
+ * `CODES` format a record is 80 bytes, each holding the six bit code of a column in its low order
+ * bits. In the `COLUMN_BINARY` format a record is 160 bytes, each column a little endian 16 bit
+ * word whose low order 12 bits are the holes punched in it, row 12 in bit 11, row 11 in bit 10,
+ * row 0 in bit 9, and rows 1 through 9 in bits 8 through 0.
+ *
+ * A code is punched as on a BCD card: its high order two bits are the zone, punched in row 0, 11,
+ * or 12 for zones 1, 2, and 3, and its low order four bits are the digit, punched in rows 1
+ * through 9 for digits 1 through 9 and as 8 plus a row 2 through 7 for digits 10 through 15. Code
+ * 0 is an unpunched column. Every code has its own pattern, so the translation is exact.
+ *
+ * Neither format needs parsing. A binary deck is read by mapping it and indexing its records.
+ * The codes are those of the character set Elsix was built with.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "charset.hpp"
+
+namespace elsix{
+
+constexpr unsigned CARD_COLUMNS = 80;
+
+enum class CardFormat: std::uint8_t{
+    // Lines of text. Not a binary deck format.
+    TEXT = 0,
+    CODES = 1,
+    COLUMN_BINARY = 2
+};
+
+constexpr std::uint16_t CARD_DECK_VERSION = 1;
+constexpr std::array<char, 8> CARD_DECK_MAGIC{'E', 'L', 'S', 'I', 'X', 'D', 'C', 'K'};
+
+struct CardDeckHeader{
+    std::array<char, 8> magic;
+    std::uint16_t version;
+    CardFormat format;
+    std::uint8_t reserved;
+    // The length of each record in bytes.
+    std::uint32_t record_bytes;
+};
+
+static_assert(16 == sizeof(CardDeckHeader), "The binary deck header must be 16 bytes.");
+
+/// The bytes in a record of the given binary format.
+constexpr unsigned record_bytes(CardFormat format) noexcept{
+    return (CardFormat::COLUMN_BINARY == format) ? 2 * CARD_COLUMNS : CARD_COLUMNS;
+}
+
+/// The holes punched for a six bit code in the column binary format.
+constexpr std::uint16_t punch_pattern(std::uint8_t code) noexcept{
+    unsigned zone = (code >> 4) & 3;
+    unsigned digit = code & 017;
+    std::uint16_t pattern = 0;
+    if(0 != zone){
+        // Zone 1 is row 0 (bit 9), zone 2 row 11 (bit 10), zone 3 row 12 (bit 11).
+        pattern |= static_cast<std::uint16_t>(1U << (8 + zone));
+    }
+    if(digit >= 1 && digit <= 9){
+        pattern |= static_cast<std::uint16_t>(1U << (9 - digit));
+    } else if(digit >= 10){
+        // Row 8 and a row from 2 to 7.
+        pattern |= static_cast<std::uint16_t>((1U << 1) | (1U << (9 - (digit - 8))));
+    }
+    return pattern;
+}
+
+/**
+ * @brief The code punched in a column of each possible 12 bit pattern. Patterns no code punches
+ * read as `invalid`.
+ */
+struct PunchCodes{
+    std::array<std::uint8_t, 4096> codes;
+
+    constexpr explicit PunchCodes(std::uint8_t invalid): codes{}{
+        for(auto &code : codes){
+            code = invalid;
+        }
+        for(unsigned code = 0; code < 64; code++){
+            codes[punch_pattern(static_cast<std::uint8_t>(code))] = static_cast<std::uint8_t>(code);
+        }
+    }
+};
+
+} // end namespace elsix
@@ -0,0 +1,509 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "cardio.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// Decodes the columns of column binary decks. A pattern no code punches reads as a blank.
+constexpr PunchCodes PUNCH_CODES{DEFAULT_CHARACTERS.blank};
+
+} // end anonymous namespace
+
+// region: CardReader
+
+CardReader::~CardReader(){
+    close();
+}
+
+bool CardReader::open(const char *path){
+    int fd = ::open(path, O_RDONLY);
+    if(fd < 0){
+        return false;
+    }
+    bool opened = open_descriptor(fd);
+    ::close(fd);
+    return opened;
+}
+
+bool CardReader::open_descriptor(int fd){
+    close();
+
+    struct stat status{};
+    if(0 == fstat(fd, &status) && S_ISREG(status.st_mode)){
+        auto bytes = static_cast<std::size_t>(status.st_size);
+        if(0 == bytes){
+            return start_(nullptr, 0);
+        }
+        void *mapping = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(MAP_FAILED != mapping){
+            madvise(mapping, bytes, MADV_SEQUENTIAL);
+            mapping_ = mapping;
+            mapped_bytes_ = bytes;
+            return start_(static_cast<const char *>(mapping), bytes);
+        }
+    }
+
+    // Not a mappable file. Read it whole, doubling the buffer as needed.
+    std::size_t capacity = std::size_t{1} << 20;
+    std::size_t bytes = 0;
+    auto buffer = std::make_unique<char[]>(capacity);
+    while(true){
+        if(bytes == capacity){
+            auto larger = std::make_unique<char[]>(2 * capacity);
+            std::memcpy(larger.get(), buffer.get(), bytes);
+            buffer = std::move(larger);
+            capacity *= 2;
+        }
+        ssize_t count = ::read(fd, buffer.get() + bytes, capacity - bytes);
+        if(count < 0 && EINTR == errno){
+            continue;
+        }
+        if(count < 0){
+            return false;
+        }
+        if(0 == count){
+            break;
+        }
+        bytes += static_cast<std::size_t>(count);
+    }
+    buffer_ = std::move(buffer);
+    return start_(buffer_.get(), bytes);
+}
+
+void CardReader::close(){
+    stop_indexer_();
+    index_chunks_.clear();
+    if(nullptr != mapping_){
+        munmap(mapping_, mapped_bytes_);
+        mapping_ = nullptr;
+        mapped_bytes_ = 0;
+    }
+    buffer_.reset();
+    data_ = end_ = card_ = card_end_ = nullptr;
+    column_ = 0;
+    card_number_ = 0;
+}
+
+bool CardReader::start_(const char *data, std::size_t bytes){
+    format_ = CardFormat::TEXT;
+    record_bytes_ = 0;
+    CardDeckHeader header{};
+    if(bytes >= sizeof(header)
+       && 0 == std::memcmp(data, CARD_DECK_MAGIC.data(), CARD_DECK_MAGIC.size())){
+        std::memcpy(&header, data, sizeof(header));
+        if(CARD_DECK_VERSION != header.version
+           || (CardFormat::CODES != header.format && CardFormat::COLUMN_BINARY != header.format)
+           || record_bytes(header.format) != header.record_bytes){
+            return false;
+        }
+        format_ = header.format;
+        record_bytes_ = header.record_bytes;
+        data += sizeof(header);
+        // A partial record at the end is not a card.
+        bytes = (bytes - sizeof(header)) / record_bytes_ * record_bytes_;
+    } else if(bytes > 0 && 0 == bytes % CARD_COLUMNS
+              && nullptr == std::memchr(data, '\n', CARD_COLUMNS)){
+        // A deck with no line terminator on its first card is taken to be fixed length records.
+        record_bytes_ = CARD_COLUMNS;
+    }
+
+    data_ = data;
+    end_ = data + bytes;
+    card_ = data;
+    column_ = 0;
+    find_card_end_();
+
+    indexed_cards_.store(0, std::memory_order_relaxed);
+    stop_indexing_.store(false, std::memory_order_relaxed);
+    if(0 != record_bytes_ || 0 == bytes){
+        index_complete_.store(true, std::memory_order_relaxed);
+        return true;
+    }
+    // Every card is at least a line terminator, except perhaps the last.
+    index_chunks_.resize(bytes / INDEX_CHUNK_CARDS + 1);
+    index_complete_.store(false, std::memory_order_relaxed);
+    return true;
+}
+
+void CardReader::start_indexer_(){
+    if(!indexer_.joinable() && !index_complete_.load(std::memory_order_relaxed)){
+        indexer_ = std::thread(&CardReader::index_loop_, this);
+    }
+}
+
+void CardReader::index_loop_() noexcept{
+    // How many cards to index between publishing progress to a waiting `seek_card()`.
+    constexpr std::size_t PUBLISH_CARDS = 4096;
+
+    const char *card = data_;
+    std::size_t cards = 0;
+    while(card < end_ && !stop_indexing_.load(std::memory_order_relaxed)){
+        std::size_t chunk = cards / INDEX_CHUNK_CARDS;
+        if(0 == cards % INDEX_CHUNK_CARDS){
+            index_chunks_[chunk] = std::make_unique<std::size_t[]>(INDEX_CHUNK_CARDS);
+        }
+        index_chunks_[chunk][cards % INDEX_CHUNK_CARDS] = static_cast<std::size_t>(card - data_);
+        cards++;
+        auto line_end = static_cast<const char *>(std::memchr(card, '\n', end_ - card));
+        card = (nullptr == line_end) ? end_ : line_end + 1;
+
+        if(0 == cards % PUBLISH_CARDS){
+            {
+                std::lock_guard<std::mutex> lock(index_mutex_);
+                indexed_cards_.store(cards, std::memory_order_release);
+            }
+            index_progress_.notify_all();
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        indexed_cards_.store(cards, std::memory_order_release);
+        index_complete_.store(true, std::memory_order_release);
+    }
+    index_progress_.notify_all();
+}
+
+void CardReader::stop_indexer_() noexcept{
+    if(indexer_.joinable()){
+        stop_indexing_.store(true, std::memory_order_relaxed);
+        indexer_.join();
+    }
+}
+
+bool CardReader::seek_card(std::size_t card){
+    column_ = 0;
+    std::size_t cards;
+    if(0 != record_bytes_ || data_ == end_){
+        cards = (0 == record_bytes_) ? 0 : static_cast<std::size_t>(end_ - data_) / record_bytes_;
+        if(card < cards){
+            card_ = data_ + card * record_bytes_;
+        }
+    } else{
+        start_indexer_();
+        if(card >= indexed_cards_.load(std::memory_order_acquire)){
+            std::unique_lock<std::mutex> lock(index_mutex_);
+            index_progress_.wait(lock, [this, card]{
+                return card < indexed_cards_.load(std::memory_order_acquire)
+                       || index_complete_.load(std::memory_order_acquire);
+            });
+        }
+        cards = indexed_cards_.load(std::memory_order_acquire);
+        if(card < cards){
+            card_ = data_ + index_chunks_[card / INDEX_CHUNK_CARDS][card % INDEX_CHUNK_CARDS];
+        }
+    }
+    if(card >= cards){
+        card_ = end_;
+        card_number_ = cards;
+        find_card_end_();
+        return false;
+    }
+    card_number_ = card;
+    find_card_end_();
+    return true;
+}
+
+std::size_t CardReader::card_count(){
+    if(0 != record_bytes_ || data_ == end_){
+        return (0 == record_bytes_) ? 0 : static_cast<std::size_t>(end_ - data_) / record_bytes_;
+    }
+    start_indexer_();
+    std::unique_lock<std::mutex> lock(index_mutex_);
+    index_progress_.wait(lock, [this]{
+        return index_complete_.load(std::memory_order_acquire);
+    });
+    return indexed_cards_.load(std::memory_order_acquire);
+}
+
+void CardReader::find_card_end_() noexcept{
+    if(card_ >= end_){
+        card_end_ = end_;
+        return;
+    }
+    if(0 != record_bytes_){
+        card_end_ = card_ + record_bytes_;
+        return;
+    }
+    auto line_end = static_cast<const char *>(std::memchr(card_, '\n', end_ - card_));
+    card_end_ = (nullptr == line_end) ? end_ : line_end;
+    if(card_end_ > card_ && '\r' == card_end_[-1]){
+        card_end_--;
+    }
+}
+
+void CardReader::next_card() noexcept{
+    column_ = 0;
+    if(card_ >= end_){
+        return;
+    }
+    card_number_++;
+    if(0 != record_bytes_){
+        card_ += record_bytes_;
+    } else{
+        // The terminator is at or just past `card_end_`, which excludes a carriage return.
+        auto line_end = static_cast<const char *>(std::memchr(card_end_, '\n', end_ - card_end_));
+        card_ = (nullptr == line_end) ? end_ : line_end + 1;
+    }
+    find_card_end_();
+}
+
+Word CardReader::read(unsigned columns) noexcept{
+    unsigned remaining = CARD_COLUMNS - column_;
+    unsigned count = std::min(columns, remaining);
+    // Only the last ten characters survive in the word, so skip the ones that would be shifted out.
+    unsigned first = column_ + count - std::min(count, CHARACTERS_PER_WORD);
+    unsigned last = column_ + count;
+    auto text_columns = static_cast<unsigned>(
+        std::min<std::ptrdiff_t>(card_end_ - card_, CARD_COLUMNS));
+
+    Word characters = 0;
+    auto card = reinterpret_cast<const std::uint8_t *>(card_);
+    if(CardFormat::CODES == format_){
+        for(unsigned column = first; column < last; column++){
+            characters = (characters << CHARACTER_BITS) | (card[column] & CHARACTER_MASK);
+        }
+    } else if(CardFormat::COLUMN_BINARY == format_){
+        for(unsigned column = first; column < last; column++){
+            unsigned pattern = card[2 * column] | ((card[2 * column + 1] & 0x0fU) << 8);
+            characters = (characters << CHARACTER_BITS) | PUNCH_CODES.codes[pattern];
+        }
+    } else{
+        for(unsigned column = first; column < last; column++){
+            std::uint8_t code = (column < text_columns)
+                                ? characters_->from_ascii[card[column]]
+                                : characters_->blank;
+            characters = (characters << CHARACTER_BITS) | code;
+        }
+    }
+
+    if(columns >= remaining){
+        next_card();
+    } else{
+        column_ = last;
+    }
+    return characters;
+}
+
+// endregion: CardReader
+
+// region: CardWriter
+
+CardWriter::CardWriter(int fd, unsigned columns, bool pad): fd_(fd), columns_(columns), pad_(pad){
+    for(auto &buffer : buffers_){
+        buffer = std::make_unique<char[]>(BUFFER_BYTES);
+    }
+    next_ = buffers_[0].get();
+    limit_ = next_ + BUFFER_BYTES;
+}
+
+CardWriter::~CardWriter(){
+    set_asynchronous(false);
+    flush();
+}
+
+void CardWriter::write(Word characters, unsigned count) noexcept{
+    count = std::min(count, CHARACTERS_PER_WORD);
+    // Every character could end a padded line.
+    reserve_((count + 1) * (columns_ + 1));
+
+    for(unsigned i = count; i > 0; i--){
+        auto code = static_cast<std::uint8_t>((characters >> ((i - 1) * CHARACTER_BITS))
+                                              & CHARACTER_MASK);
+        if(END_OF_LINE_CODE == code){
+            put_line_end_();
+            continue;
+        }
+        if(column_ == columns_){
+            put_line_end_();
+        }
+        *next_++ = characters_->to_ascii[code];
+        column_++;
+    }
+}
+
+void CardWriter::end_line() noexcept{
+    reserve_(columns_ + 1);
+    put_line_end_();
+}
+
+void CardWriter::put_line_end_() noexcept{
+    if(pad_){
+        std::memset(next_, ' ', columns_ - column_);
+        next_ += columns_ - column_;
+    }
+    *next_++ = '\n';
+    column_ = 0;
+}
+
+void CardWriter::reserve_(std::size_t bytes) noexcept{
+    if(static_cast<std::size_t>(limit_ - next_) < bytes){
+        publish_();
+    }
+}
+
+void CardWriter::publish_() noexcept{
+    std::size_t published = published_.load(std::memory_order_relaxed);
+    std::size_t index = published % BUFFER_COUNT;
+    used_[index] = BUFFER_BYTES - static_cast<std::size_t>(limit_ - next_);
+    if(0 == used_[index]){
+        return;
+    }
+    published_.store(++published, std::memory_order_release);
+
+    if(asynchronous()){
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        filled_.notify_one();
+        // The next buffer must not still be waiting to be written.
+        wait_for_written_(BUFFER_COUNT - 1);
+    } else if(published - written_.load(std::memory_order_relaxed) == BUFFER_COUNT){
+        write_buffers_(written_.load(std::memory_order_relaxed), published);
+        written_.store(published, std::memory_order_relaxed);
+    }
+
+    next_ = buffers_[published % BUFFER_COUNT].get();
+    limit_ = next_ + BUFFER_BYTES;
+}
+
+void CardWriter::flush() noexcept{
+    publish_();
+    if(asynchronous()){
+        wait_for_written_(0);
+        return;
+    }
+    std::size_t published = published_.load(std::memory_order_relaxed);
+    write_buffers_(written_.load(std::memory_order_relaxed), published);
+    written_.store(published, std::memory_order_relaxed);
+}
+
+void CardWriter::wait_for_written_(std::size_t pending) noexcept{
+    auto drained = [this, pending](){
+        return published_.load(std::memory_order_relaxed)
+               - written_.load(std::memory_order_acquire) <= pending;
+    };
+    if(drained()){
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        drained_.wait(lock, drained);
+    }
+    blocked_time_ += std::chrono::steady_clock::now() - start;
+}
+
+void CardWriter::write_buffers_(std::size_t first, std::size_t last) noexcept{
+    std::array<iovec, BUFFER_COUNT> vectors{};
+    int vector_count = 0;
+    for(std::size_t i = first; i != last; i++){
+        std::size_t index = i % BUFFER_COUNT;
+        vectors[vector_count].iov_base = buffers_[index].get();
+        vectors[vector_count].iov_len = used_[index];
+        vector_count++;
+    }
+
+    iovec *vector = vectors.data();
+    while(vector_count > 0 && !failed()){
+        ssize_t written = ::writev(fd_, vector, vector_count);
+        if(written < 0){
+            if(EINTR != errno){
+                failed_.store(true, std::memory_order_relaxed);
+            }
+            continue;
+        }
+        // Step past what was written, which may end partway through a buffer.
+        auto remaining = static_cast<std::size_t>(written);
+        while(vector_count > 0 && remaining >= vector->iov_len){
+            remaining -= vector->iov_len;
+            vector++;
+            vector_count--;
+        }
+        if(vector_count > 0){
+            vector->iov_base = static_cast<char *>(vector->iov_base) + remaining;
+            vector->iov_len -= remaining;
+        }
+    }
+}
+
+void CardWriter::set_asynchronous(bool enabled){
+    if(enabled == asynchronous()){
+        return;
+    }
+    flush();
+    if(enabled){
+        stopping_ = false;
+        writer_ = std::thread(&CardWriter::writer_loop_, this);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    filled_.notify_one();
+    writer_.join();
+}
+
+void CardWriter::writer_loop_() noexcept{
+    std::size_t written = written_.load(std::memory_order_relaxed);
+    while(true){
+        std::size_t published = published_.load(std::memory_order_acquire);
+        if(published == written){
+            std::unique_lock<std::mutex> lock(mutex_);
+            if(stopping_ && published_.load(std::memory_order_acquire) == written){
+                return;
+            }
+            filled_.wait(lock, [this, written](){
+                return stopping_ || published_.load(std::memory_order_acquire) != written;
+            });
+            continue;
+        }
+
+        write_buffers_(written, published);
+        written = published;
+        written_.store(written, std::memory_order_release);
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        drained_.notify_one();
+    }
+}
+
+// endregion: CardWriter
+
+} // end namespace elsix
@@ -0,0 +1,268 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Card image input and output, which implements Input, Print, and Punch.
+ *
+ * An input deck is a file of 80 column card images, either one card per line or fixed 80 byte
+ * records with no line terminators. The deck is memory mapped, and the reader keeps a cursor into
+ * the mapping, so reading a card copies nothing. A line shorter than 80 columns reads as if padded
+ * with blanks.
+ *
+ * An input deck can also be read out of order by seeking to a card. The card of fixed records is
+ * found by multiplication. For a deck of lines, the first seek starts a background thread that
+ * indexes where each card begins while the program goes on, so a seek is a lookup once the index
+ * reaches the card. A deck that is only read sequentially is never indexed.
+ *
+ * Printed lines and punched cards are assembled directly in a set of large output buffers, which
+ * are written with a single `writev` when they are all full or on `flush()`. Neither path makes a
+ * system call per character or per line. Optionally a writer thread does the writing, so that a
+ * slow pipe or disk does not stall the interpreter.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+#include "field.hpp"
+#include "charset.hpp"
+#include "cardformat.hpp"
+
+namespace elsix{
+
+constexpr unsigned PRINT_COLUMNS = 132;
+
+class CardReader{
+public:
+    CardReader() = default;
+    ~CardReader();
+    CardReader(const CardReader &) = delete;
+    CardReader &operator=(const CardReader &) = delete;
+
+    /// Opens the deck at `path`, a text deck or a binary deck. Returns false if it cannot be read.
+    bool open(const char *path);
+
+    /// Opens the deck on an open file descriptor, such as standard input. A descriptor that
+    /// cannot be mapped, such as a pipe, is read into memory in large blocks.
+    bool open_descriptor(int fd);
+
+    void close();
+
+    /**
+     * @brief Implements `(a, IN, cd)`: reads the next `columns` columns of the current card as six
+     * bit characters, the last column read in the low order bits.
+     *
+     * A read does not continue onto the next card. When it reaches the end of the current card the
+     * cursor moves to column 1 of the next card, so `(X, IN, 73)` or any read of more columns than
+     * remain skips the rest of the card. Only the last ten characters read fit in a word. Past the
+     * end of the deck every column reads as a blank.
+     */
+    Word read(unsigned columns) noexcept;
+
+    /// Skips the remainder of the current card.
+    void next_card() noexcept;
+
+    [[nodiscard]] bool at_end() const noexcept{
+        return card_ >= end_;
+    }
+
+    /**
+     * @brief Moves the cursor to column 1 of card `card`, counting the first card of the deck as
+     * card 0. Starts indexing a deck of lines, and waits for the index to reach the card.
+     * @return False, leaving the cursor at the end of the deck, if the deck has no such card.
+     */
+    bool seek_card(std::size_t card);
+
+    /// The zero based number of the current card.
+    [[nodiscard]] std::size_t card_number() const noexcept{
+        return card_number_;
+    }
+
+    /// The number of cards in the deck. Indexes a deck of lines to the end.
+    [[nodiscard]] std::size_t card_count();
+
+    /// The zero based column of the cursor within the current card.
+    [[nodiscard]] unsigned column() const noexcept{
+        return column_;
+    }
+
+    void set_character_set(const CharacterSet &characters) noexcept{
+        characters_ = &characters;
+    }
+
+private:
+    const char *data_ = nullptr;
+    const char *end_ = nullptr;
+    // The current card image and the end of its text, excluding any line terminator.
+    const char *card_ = nullptr;
+    const char *card_end_ = nullptr;
+    unsigned column_ = 0;
+    // The length of each card's record, or 0 for a deck of lines.
+    std::size_t record_bytes_ = 0;
+    // Text, or one of the binary deck formats.
+    CardFormat format_ = CardFormat::TEXT;
+
+    std::size_t card_number_ = 0;
+
+    void *mapping_ = nullptr;
+    std::size_t mapped_bytes_ = 0;
+    // Holds a deck that could not be mapped.
+    std::unique_ptr<char[]> buffer_;
+
+    // The card index of a deck of lines: the offset of card `n` is entry `n % INDEX_CHUNK_CARDS`
+    // of chunk `n / INDEX_CHUNK_CARDS`. There is a slot for every chunk a deck of that many bytes
+    // could need, so the indexer fills in chunks without moving anything the reader can see.
+    // Entries below `indexed_cards_` are complete.
+    static constexpr std::size_t INDEX_CHUNK_CARDS = std::size_t{1} << 16;
+    std::vector<std::unique_ptr<std::size_t[]>> index_chunks_;
+    std::atomic<std::size_t> indexed_cards_{0};
+    std::atomic<bool> index_complete_{false};
+    std::atomic<bool> stop_indexing_{false};
+    std::thread indexer_;
+    // Only for sleeping until the index reaches a card.
+    std::mutex index_mutex_;
+    std::condition_variable index_progress_;
+
+    const CharacterSet *characters_ = &DEFAULT_CHARACTERS;
+
+    /// Returns false for a binary deck that cannot be read.
+    [[nodiscard]] bool start_(const char *data, std::size_t bytes);
+    void find_card_end_() noexcept;
+    /// Starts the indexer of a deck of lines, unless it has started or is not needed.
+    void start_indexer_();
+    void index_loop_() noexcept;
+    void stop_indexer_() noexcept;
+};
+
+class CardWriter{
+public:
+    static constexpr std::size_t BUFFER_BYTES = std::size_t{1} << 16;
+    static constexpr std::size_t BUFFER_COUNT = 8;
+
+    /**
+     * @brief Writes lines of at most `columns` characters to `fd`. When `pad` is set every line is
+     * padded with blanks to exactly `columns` characters, as punched cards are.
+     */
+    CardWriter(int fd, unsigned columns, bool pad);
+    ~CardWriter();
+    CardWriter(const CardWriter &) = delete;
+    CardWriter &operator=(const CardWriter &) = delete;
+
+    /**
+     * @brief Implements `(cd, PR, co)` and `(cd, PU, co)`: writes the low order `count`
+     * characters of `characters`, at most ten. The code 77 (octal) ends the line, as does
+     * reaching the last column.
+     */
+    void write(Word characters, unsigned count) noexcept;
+
+    /// Ends the current line, which may be empty.
+    void end_line() noexcept;
+
+    /**
+     * @brief Writes out everything buffered and waits until it has been written. The current
+     * partial line is written as it stands. Called on `DONE` and on exit.
+     */
+    void flush() noexcept;
+
+    /**
+     * @brief In asynchronous mode a writer thread drains filled buffers while the interpreter goes
+     * on filling the next ones. Output order is unchanged. The buffers are a fixed ring, so when
+     * the writer falls `BUFFER_COUNT` buffers behind, the interpreter waits for it.
+     */
+    void set_asynchronous(bool enabled);
+
+    [[nodiscard]] bool asynchronous() const noexcept{
+        return writer_.joinable();
+    }
+
+    /// The total time the interpreter has spent waiting for output to be written.
+    [[nodiscard]] std::chrono::nanoseconds blocked_time() const noexcept{
+        return blocked_time_;
+    }
+
+    /// Did a write to the file descriptor fail?
+    [[nodiscard]] bool failed() const noexcept{
+        return failed_.load(std::memory_order_relaxed);
+    }
+
+    void set_character_set(const CharacterSet &characters) noexcept{
+        characters_ = &characters;
+    }
+
+private:
+    int fd_;
+    unsigned columns_;
+    bool pad_;
+    unsigned column_ = 0;
+    std::atomic<bool> failed_{false};
+
+    // The buffers form a single producer, single consumer ring. Buffers `written_` up to
+    // `published_` (modulo `BUFFER_COUNT`) are full and waiting to be written. The interpreter
+    // fills buffer `published_` and alone advances `published_`; whoever writes advances
+    // `written_`.
+    std::array<std::unique_ptr<char[]>, BUFFER_COUNT> buffers_;
+    std::array<std::size_t, BUFFER_COUNT> used_{};
+    std::atomic<std::size_t> published_{0};
+    std::atomic<std::size_t> written_{0};
+    // The next free byte of the current buffer and the end of the current buffer.
+    char *next_ = nullptr;
+    char *limit_ = nullptr;
+
+    // The writer thread of asynchronous mode. The mutex is only for sleeping and waking.
+    std::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable filled_;
+    std::condition_variable drained_;
+    bool stopping_ = false;
+    std::chrono::nanoseconds blocked_time_{0};
+
+    const CharacterSet *characters_ = &DEFAULT_CHARACTERS;
+
+    /// Ensures that `bytes` bytes may be written at `next_`.
+    void reserve_(std::size_t bytes) noexcept;
+    void put_line_end_() noexcept;
+    /// Hands the current buffer, if not empty, to whoever writes.
+    void publish_() noexcept;
+    /// Waits until at most `pending` published buffers remain unwritten.
+    void wait_for_written_(std::size_t pending) noexcept;
+    /// Writes the published buffers `first` up to `last`.
+    void write_buffers_(std::size_t first, std::size_t last) noexcept;
+    void writer_loop_() noexcept;
+};
+
+} // end namespace elsix
@@ -0,0 +1,143 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Six bit character codes.
+ *
+ * Characters are held in words as six bit codes, packed right justified, the last character in
+ * the low order bits, as on the 7094. A 64 bit word holds ten characters. See
+ * doc/CharacterSets.md for the character sets.
+ *
+ * The character set of a program, used for its Hollerith literals and its input and output, is
+ * chosen when Elsix is built by defining one of `ELSIX_CHARACTER_SET_ASCII` (the default),
+ * `ELSIX_CHARACTER_SET_BCD`, or `ELSIX_CHARACTER_SET_GE635`.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "field.hpp"
+
+namespace elsix{
+
+constexpr unsigned CHARACTER_BITS = 6;
+constexpr unsigned CHARACTERS_PER_WORD = WORD_BITS / CHARACTER_BITS;
+constexpr Word CHARACTER_MASK = (Word{1} << CHARACTER_BITS) - 1;
+
+/// Printing or punching this code ends the line or card. In the character sets that give it a
+/// character, that character cannot be printed.
+constexpr std::uint8_t END_OF_LINE_CODE = 077;
+
+/**
+ * @brief Translation tables between a six bit character set and ASCII.
+ */
+struct CharacterSet{
+    // The ASCII character for each code. Codes without one print as '?'.
+    std::array<char, 64> to_ascii;
+    // The code for each ASCII character. Characters without one read as a blank.
+    std::array<std::uint8_t, 256> from_ascii;
+    std::uint8_t blank;
+    // The code of the digit 0. The other digits follow it.
+    std::uint8_t zero;
+};
+
+/**
+ * @brief Builds a `CharacterSet` at compile time from the ASCII characters of codes 0 through 63,
+ * where '\0' marks an unassigned code. Lower case letters read as upper case.
+ */
+constexpr CharacterSet make_character_set(const char (&characters)[65]){
+    CharacterSet set{};
+    for(unsigned code = 0; code < 64; code++){
+        if(' ' == characters[code]){
+            set.blank = static_cast<std::uint8_t>(code);
+        }
+        if('0' == characters[code]){
+            set.zero = static_cast<std::uint8_t>(code);
+        }
+    }
+    for(std::uint8_t &code : set.from_ascii){
+        code = set.blank;
+    }
+    for(unsigned code = 0; code < 64; code++){
+        char c = characters[code];
+        set.to_ascii[code] = ('\0' == c) ? '?' : c;
+        if('\0' != c){
+            set.from_ascii[static_cast<unsigned char>(c)] = static_cast<std::uint8_t>(code);
+            if('A' <= c && 'Z' >= c){
+                set.from_ascii[static_cast<unsigned char>(c - 'A' + 'a')] =
+                    static_cast<std::uint8_t>(code);
+            }
+        }
+    }
+    return set;
+}
+
+/// The printing ASCII characters from space through underscore, each coded as its ASCII code
+/// less 40 (octal).
+inline constexpr CharacterSet ASCII_CHARACTERS = make_character_set(
+    " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_"
+);
+
+/// The IBM 7094 binary coded decimal character set, in which each digit is its own code.
+inline constexpr CharacterSet BCD_CHARACTERS = make_character_set(
+    "0123456789\0=\"\0\0\0+ABCDEFGHI\0.)\0\0\0-JKLMNOPQR\0$*\0\0\0 /STUVWXYZ\0,(\0\0\0"
+);
+
+/// The GE-635 binary coded decimal character set.
+inline constexpr CharacterSet GE635_CHARACTERS = make_character_set(
+    "0123456789[#@:>? ABCDEFGHI&.](<\\^JKLMNOPQR-$*);'+/STUVWXYZ_,%=\"!"
+);
+
+#if defined(ELSIX_CHARACTER_SET_BCD)
+inline constexpr CharacterSet DEFAULT_CHARACTERS = BCD_CHARACTERS;
+#elif defined(ELSIX_CHARACTER_SET_GE635)
+inline constexpr CharacterSet DEFAULT_CHARACTERS = GE635_CHARACTERS;
+#else
+inline constexpr CharacterSet DEFAULT_CHARACTERS = ASCII_CHARACTERS;
+#endif
+
+/**
+ * @brief Packs the text of a Hollerith literal into a word, right justified, so that at run time
+ * the literal is an ordinary number. Only the last ten characters of a longer literal fit.
+ */
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+constexpr Word encode_hollerith(std::string_view text) noexcept{
+    Word characters = 0;
+    for(char c : text){
+        characters = (characters << CHARACTER_BITS)
+                   | Characters.from_ascii[static_cast<unsigned char>(c)];
+    }
+    return characters;
+}
+
+} // end namespace elsix
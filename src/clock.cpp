@@ -0,0 +1,122 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define ELSIX_HAVE_TSC 1
+#endif
+
+#include "clock.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// How long to measure the time stamp counter against the monotonic clock.
+constexpr Word CALIBRATION_NANOSECONDS = 2000000;
+
+Word monotonic_nanoseconds() noexcept{
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<Word>(now.tv_sec) * 1000000000 + static_cast<Word>(now.tv_nsec);
+}
+
+#if defined(ELSIX_HAVE_TSC)
+/// Does the time stamp counter run at a constant rate regardless of power states?
+bool invariant_tsc() noexcept{
+    unsigned eax, ebx, ecx, edx;
+    if(0 == __get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007){
+        return false;
+    }
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return 0 != (edx & (1U << 8));
+}
+#endif
+
+} // end anonymous namespace
+
+ProgramClock::ProgramClock(ClockMode mode, Word operations_per_millisecond)
+    : mode_(mode),
+      operations_per_millisecond_(0 == operations_per_millisecond ? 1 : operations_per_millisecond){
+    start();
+}
+
+void ProgramClock::calibrate_() const noexcept{
+    calibrated_ = true;
+#if defined(ELSIX_HAVE_TSC)
+    if(!invariant_tsc()){
+        return;
+    }
+    // Measure over the time since the start, which has usually run long enough already.
+    Word nanoseconds;
+    Word ticks;
+    do{
+        nanoseconds = monotonic_nanoseconds() - start_nanoseconds_;
+        ticks = __rdtsc() - start_ticks_;
+    } while(nanoseconds < CALIBRATION_NANOSECONDS);
+    if(ticks < nanoseconds / 1000){
+        // Under a megahertz. Something is wrong; use the monotonic clock.
+        return;
+    }
+    // ticks per millisecond = ticks * 10^6 / nanoseconds
+    DoubleWord ticks_per_millisecond = static_cast<DoubleWord>(ticks) * 1000000 / nanoseconds;
+    tick_scale_ = static_cast<Word>((static_cast<DoubleWord>(1) << WORD_BITS)
+                                    / ticks_per_millisecond);
+#endif
+}
+
+void ProgramClock::start() noexcept{
+    operations_ = 0;
+#if defined(ELSIX_HAVE_TSC)
+    start_ticks_ = __rdtsc();
+#endif
+    start_nanoseconds_ = monotonic_nanoseconds();
+}
+
+Word ProgramClock::milliseconds() const noexcept{
+    if(ClockMode::DETERMINISTIC == mode_){
+        return operations_ / operations_per_millisecond_;
+    }
+    if(!calibrated_){
+        calibrate_();
+    }
+#if defined(ELSIX_HAVE_TSC)
+    if(0 != tick_scale_){
+        Word ticks = __rdtsc() - start_ticks_;
+        return static_cast<Word>((static_cast<DoubleWord>(ticks) * tick_scale_) >> WORD_BITS);
+    }
+#endif
+    return (monotonic_nanoseconds() - start_nanoseconds_) / 1000000;
+}
+
+} // end namespace elsix
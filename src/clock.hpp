@@ -0,0 +1,121 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The program clock, which supplies `T.`, the time in milliseconds since the program began.
+ *
+ * Programs read `T.` in tight loops, so reading it must be cheap. The clock has two modes.
+ *
+ * In real time mode, `T.` is read from the processor's time stamp counter where it runs at a
+ * constant rate, scaled by a factor measured against the monotonic clock. The factor is measured
+ * over the time from the start to the first read of `T.`, so a program that never reads it pays
+ * nothing, and one that reads it at once waits out the rest of the measurement then. Otherwise it
+ * is read from the monotonic clock, which Linux supplies through the vDSO. Neither makes a system
+ * call.
+ *
+ * In deterministic mode, `T.` is the number of operations executed so far divided by a fixed
+ * number of operations per millisecond. A program then sees the same times on every run, which
+ * makes benchmark runs and replays reproducible.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "field.hpp"
+
+namespace elsix{
+
+enum class ClockMode{
+    REAL_TIME,
+    DETERMINISTIC
+};
+
+class ProgramClock{
+public:
+    static constexpr Word DEFAULT_OPERATIONS_PER_MILLISECOND = 100000;
+
+    explicit ProgramClock(ClockMode mode = ClockMode::REAL_TIME,
+                          Word operations_per_millisecond = DEFAULT_OPERATIONS_PER_MILLISECOND);
+
+    /// Starts the clock at zero. Called when the program begins.
+    void start() noexcept;
+
+    /// Counts an executed operation. The interpreter calls this for every operation.
+    void count_operation() noexcept{
+        operations_++;
+    }
+
+    /// Counts `count` executed operations at once, as compiled code does for a straight run.
+    void count_operations(Word count) noexcept{
+        operations_ += count;
+    }
+
+    [[nodiscard]] Word operations() const noexcept{
+        return operations_;
+    }
+
+    /// The operation count, for compiled code that counts operations itself.
+    [[nodiscard]] Word *operations_address() noexcept{
+        return &operations_;
+    }
+
+    /// The value of `T.`.
+    [[nodiscard]] Word milliseconds() const noexcept;
+
+    [[nodiscard]] ClockMode mode() const noexcept{
+        return mode_;
+    }
+
+    /// Does real time mode read the time stamp counter rather than the monotonic clock? Known
+    /// once `T.` has been read.
+    [[nodiscard]] bool uses_time_stamp_counter() const noexcept{
+        return 0 != tick_scale_;
+    }
+
+private:
+    ClockMode mode_;
+    Word operations_per_millisecond_;
+    Word operations_ = 0;
+
+    // Real time mode. Milliseconds are (ticks since the start * tick_scale_) / 2^64. A scale of
+    // zero means there is no usable time stamp counter.
+    Word start_ticks_ = 0;
+    mutable Word tick_scale_ = 0;
+    // The monotonic clock at the start, in nanoseconds, for when there is no time stamp counter
+    // and to measure the time stamp counter against.
+    Word start_nanoseconds_ = 0;
+    mutable bool calibrated_ = false;
+
+    /// Measures `tick_scale_`, on the first read of `T.`.
+    void calibrate_() const noexcept;
+};
+
+} // end namespace elsix
@@ -0,0 +1,296 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include "conditions.hpp"
+#include "controlflow.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// Is the instruction a test, or a superinstruction that begins with one?
+bool begins_with_test(const Instruction &instruction) noexcept{
+    return is_test(instruction.opcode) || Opcode::TEST_OR_DONE == instruction.opcode
+           || Opcode::TEST_OR_FAIL == instruction.opcode
+           || Opcode::TEST_OR_INTERCHANGE == instruction.opcode;
+}
+
+/// Can the operand be read at any point without a fault or any other effect?
+bool pure(const Operand &operand) noexcept{
+    return OperandKind::LITERAL == operand.kind || OperandKind::BUG == operand.kind
+           || OperandKind::AVAILABLE == operand.kind;
+}
+
+/**
+ * @brief Reorders the tests `first` to `end` of a line, if they are the tests of one compound
+ * condition. Returns true if it changed their order.
+ *
+ * Each test but the last jumps to the same place under the same condition, which ends the chain.
+ * Either they jump where the last test does, under the same condition, which is the IFALL and
+ * IFNONE shape, or they jump to the body, which follows the last test, under the opposite
+ * condition to the last test, the IFANY and IFNALL shape. The flags and target belong to the
+ * position in the chain, so a test moved to or from the end takes on those of its new position.
+ */
+bool reorder(Program &program, const TestProfile &profile, const std::vector<bool> &targets,
+             std::uint32_t first, std::uint32_t end){
+    std::vector<Instruction> &instructions = program.instructions;
+    const Instruction &early = instructions[first];
+    const Instruction &last = instructions[end - 1];
+    for(std::uint32_t i = first; i < end; i++){
+        const Instruction &test = instructions[i];
+        if(!is_test(test.opcode) || !pure(program.operand(test, 0))
+           || !pure(program.operand(test, 1)) || (i > first && targets[i])){
+            return false;
+        }
+        if(i + 1 < end && (test.flags != early.flags || test.target != early.target)){
+            return false;
+        }
+    }
+    bool same_exit = early.flags == last.flags && early.target == last.target;
+    bool to_body = early.flags != last.flags
+                   && (early.target == end
+                       || (end < instructions.size() && Opcode::JUMP == instructions[end].opcode
+                           && instructions[end].target == early.target));
+    if(!same_exit && !to_body){
+        return false;
+    }
+
+    // How often each test decided the outcome when it ran. The last test always decides, but
+    // it would have decided earlier in the chain only when it passed to the body.
+    struct Ranked{
+        Instruction test;
+        double rate;
+    };
+    std::vector<Ranked> ranked;
+    for(std::uint32_t i = first; i < end; i++){
+        const TestProfile::Counts &counts = profile.counts(i);
+        Word decided = (i + 1 == end && to_body) ? counts.executions - counts.jumps : counts.jumps;
+        double rate = (0 == counts.executions) ? 0.0
+                                               : static_cast<double>(decided) / counts.executions;
+        ranked.push_back({instructions[i], rate});
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), [](const Ranked &a, const Ranked &b){
+        return a.rate > b.rate;
+    });
+
+    std::uint8_t early_flags = early.flags;
+    std::uint32_t early_target = early.target;
+    std::uint8_t last_flags = last.flags;
+    std::uint32_t last_target = last.target;
+    bool changed = false;
+    for(std::uint32_t i = first; i < end; i++){
+        Instruction test = ranked[i - first].test;
+        test.flags = (i + 1 == end) ? last_flags : early_flags;
+        test.target = (i + 1 == end) ? last_target : early_target;
+        changed = changed || test.opcode != instructions[i].opcode
+                  || test.operands != instructions[i].operands;
+        instructions[i] = test;
+    }
+    return changed;
+}
+
+/// Is the instruction an equality test of an operand against a literal, which jumps if they
+/// differ? If so, `subject` is set to the index of the operand that is not the literal.
+bool ladder_test(const Program &program, const Instruction &instruction, unsigned &subject){
+    bool jumps_if_different =
+        ((Opcode::TEST_EQUAL == instruction.opcode || Opcode::TEST_SAME_BLOCK == instruction.opcode)
+         && INVERT == instruction.flags)
+        || (Opcode::TEST_NOT_EQUAL == instruction.opcode && 0 == instruction.flags);
+    if(!jumps_if_different || NO_INDEX == instruction.target){
+        return false;
+    }
+    for(unsigned i = 0; i < 2; i++){
+        const Operand &operand = program.operand(instruction, i);
+        const Operand &other = program.operand(instruction, 1 - i);
+        if(OperandKind::LITERAL == other.kind
+           && (OperandKind::BUG == operand.kind || OperandKind::FIELD == operand.kind)){
+            subject = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool same_operand(const Program &program, const Operand &a, const Operand &b){
+    return a.kind == b.kind && a.bug == b.bug && a.length == b.length
+           && std::equal(program.paths.begin() + a.path, program.paths.begin() + a.path + a.length,
+                         program.paths.begin() + b.path);
+}
+
+} // end anonymous namespace
+
+// region: TestProfile
+
+bool TestProfile::save(const Program &program, const std::string &path) const{
+    std::ofstream file(path);
+    file << "# Elsix test profile: row, test, executions, jumps\n";
+    for(std::uint32_t i = 0; i < counts_.size(); i++){
+        if(0 == counts_[i].executions){
+            continue;
+        }
+        const LineInfo &line = program.lines[program.instructions[i].line];
+        file << line.row << ' ' << i - line.first << ' ' << counts_[i].executions << ' '
+             << counts_[i].jumps << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+bool TestProfile::load(const Program &program, const std::string &path){
+    std::ifstream file(path);
+    if(!file){
+        return false;
+    }
+    std::unordered_map<std::uint32_t, std::uint32_t> lines;
+    for(std::uint32_t line = 0; line < program.lines.size(); line++){
+        lines.emplace(program.lines[line].row, line);
+    }
+    for(std::string text; std::getline(file, text);){
+        std::istringstream record(text);
+        std::uint32_t row, offset;
+        Counts counts;
+        if(text.empty() || '#' == text[0]
+           || !(record >> row >> offset >> counts.executions >> counts.jumps)){
+            continue;
+        }
+        auto found = lines.find(row);
+        if(lines.end() == found){
+            continue;
+        }
+        std::uint32_t index = program.lines[found->second].first + offset;
+        if(index < program.instructions.size() && program.instructions[index].line == found->second
+           && begins_with_test(program.instructions[index])){
+            counts_[index] = counts;
+        }
+    }
+    return !file.bad();
+}
+
+// endregion: TestProfile
+
+std::size_t order_tests(Program &program, const TestProfile &profile){
+    std::vector<bool> targets = entry_points(program);
+    std::size_t reordered = 0;
+    for(std::uint32_t line = 0; line < program.lines.size(); line++){
+        std::uint32_t first = program.lines[line].first;
+        std::uint32_t end = first;
+        while(end < program.instructions.size() && program.instructions[end].line == line
+              && is_test(program.instructions[end].opcode)){
+            end++;
+        }
+        if(end - first >= 2 && reorder(program, profile, targets, first, end)){
+            reordered++;
+        }
+    }
+    return reordered;
+}
+
+std::size_t compile_ladders(Program &program){
+    std::vector<Instruction> &instructions = program.instructions;
+    auto size = static_cast<std::uint32_t>(instructions.size());
+    std::vector<unsigned> subjects(size, 2);
+    for(std::uint32_t i = 0; i < size; i++){
+        unsigned subject;
+        if(ladder_test(program, instructions[i], subject)){
+            subjects[i] = subject;
+        }
+    }
+    auto subject_of = [&](std::uint32_t i) -> const Operand &{
+        return program.operand(instructions[i], subjects[i]);
+    };
+    auto continues = [&](std::uint32_t from, std::uint32_t to){
+        return to < size && 2 != subjects[to] && same_operand(program, subject_of(from),
+                                                               subject_of(to));
+    };
+
+    // A ladder starts at a test that no test of the same operand goes on to.
+    std::vector<bool> continued(size, false);
+    for(std::uint32_t i = 0; i < size; i++){
+        if(2 != subjects[i] && continues(i, instructions[i].target)){
+            continued[instructions[i].target] = true;
+        }
+    }
+
+    std::size_t ladders = 0;
+    std::vector<SwitchCase> cases;
+    std::vector<bool> seen(size, false);
+    for(std::uint32_t head = 0; head < size; head++){
+        if(2 == subjects[head] || continued[head]){
+            continue;
+        }
+        // The value that passes each test, and where to go to pass it. The first test passes
+        // by going on to its body; a later one by running it, as the ladder would have.
+        cases.clear();
+        std::size_t tests = 0;
+        std::uint32_t index = head;
+        std::uint32_t next = head + 1;
+        while(true){
+            seen[index] = true;
+            tests++;
+            Word value = program.operand(instructions[index], 1 - subjects[index]).value;
+            auto same = [value](const SwitchCase &c){ return c.value == value; };
+            if(cases.end() == std::find_if(cases.begin(), cases.end(), same)){
+                cases.push_back({value, next});
+            }
+            std::uint32_t target = instructions[index].target;
+            if(!continues(index, target) || seen[target]){
+                next = target;
+                break;
+            }
+            index = target;
+            next = target;
+        }
+        if(tests < MINIMUM_LADDER){
+            continue;
+        }
+
+        std::sort(cases.begin(), cases.end(), [](const SwitchCase &a, const SwitchCase &b){
+            return a.value < b.value;
+        });
+        Instruction &first = instructions[head];
+        if(1 == subjects[head]){
+            std::swap(first.operands[0], first.operands[1]);
+        }
+        first.opcode = Opcode::SWITCH;
+        first.flags = 0;
+        first.alternate = next;
+        first.operands[2] = static_cast<std::uint32_t>(cases.size());
+        first.operands[3] = static_cast<std::uint32_t>(program.cases.size());
+        program.cases.insert(program.cases.end(), cases.begin(), cases.end());
+        ladders++;
+    }
+    return ladders;
+}
+
+} // end namespace elsix
@@ -0,0 +1,118 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Passes over the tests of IFs: ordering the tests of a compound condition by profile,
+ * and turning ladders of equality tests into table dispatch.
+ *
+ * The tests of an IFANY, IFALL, IFNALL, or IFNONE are lowered to a chain that stops at the first
+ * test that decides the outcome (see `Lowering::lower_if_`). Which test that is depends on the
+ * data, so `order_tests` puts the tests most likely to decide first, by a `TestProfile` recorded
+ * by the interpreter on an earlier run. A test is only moved if its operands are literals, bugs,
+ * or `AV.`, since a field operand may fault where an earlier test would have stopped the chain.
+ *
+ * Decoders are written as ladders of lines such as
+ *
+ *     IF (X, E, 1) THEN PLUS
+ *     IF (X, E, 2) THEN MINUS
+ *     IF (X, E, 3) THEN TIMES
+ *
+ * each testing the same operand against a different constant and going on to the next line if
+ * it differs. `compile_ladders` replaces the first test of such a ladder with a SWITCH, which
+ * finds the line whose test will pass and goes straight to it; the tests themselves stay, since
+ * the lines may be entered by other jumps and the operand may change in a body that falls
+ * through to the next line. The interpreter searches the cases of a SWITCH by binary search, and
+ * the translator emits a C++ `switch`, which the compiler builds into a jump table where the
+ * values are dense.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "program.hpp"
+
+namespace elsix{
+
+/// How often each test ran and jumped, by instruction.
+class TestProfile{
+public:
+    struct Counts{
+        Word executions = 0;
+        Word jumps = 0;
+    };
+
+    explicit TestProfile(const Program &program) : counts_(program.instructions.size()){
+    }
+
+    void record(std::uint32_t instruction, bool jumped) noexcept{
+        counts_[instruction].executions++;
+        counts_[instruction].jumps += jumped ? 1 : 0;
+    }
+
+    [[nodiscard]] const Counts &counts(std::uint32_t instruction) const noexcept{
+        return counts_[instruction];
+    }
+
+    /**
+     * @brief Writes the profile as text, one test to a line, identifying each test by the source
+     * row of its line and its position within the line, so that the profile still applies to
+     * the program after it is loaded and lowered again.
+     */
+    [[nodiscard]] bool save(const Program &program, const std::string &path) const;
+
+    /// Reads a profile `save` wrote. Tests that are no longer in the program are ignored.
+    [[nodiscard]] bool load(const Program &program, const std::string &path);
+
+private:
+    std::vector<Counts> counts_;
+};
+
+/**
+ * @brief Orders the tests of each compound condition so that the test most likely to decide the
+ * outcome comes first.
+ * @return The number of conditions reordered.
+ */
+std::size_t order_tests(Program &program, const TestProfile &profile);
+
+/// The fewest tests worth a SWITCH.
+constexpr std::size_t MINIMUM_LADDER = 4;
+
+/**
+ * @brief Replaces the first test of each ladder of at least `MINIMUM_LADDER` equality tests with
+ * a SWITCH.
+ * @return The number of ladders.
+ */
+std::size_t compile_ladders(Program &program);
+
+} // end namespace elsix
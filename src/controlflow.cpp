@@ -0,0 +1,356 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+
+#include "controlflow.hpp"
+#include "fusion.hpp"
+
+namespace elsix{
+
+namespace{
+
+/**
+ * @brief Rebuilds `program` from the lines in `order`, leaving out the instructions marked in
+ * `drop`. Jumps to a dropped instruction are retargeted to the instruction that follows it in the
+ * new order, so control must be able to pass over it, as over a jump to that instruction.
+ */
+void rebuild(Program &program, const std::vector<std::uint32_t> &order,
+             const std::vector<bool> &drop){
+    auto size = static_cast<std::uint32_t>(program.instructions.size());
+    std::vector<std::uint32_t> new_index(size, NO_INDEX);
+    std::vector<std::uint32_t> new_line(program.lines.size(), NO_INDEX);
+    std::vector<Instruction> instructions;
+    std::vector<LineInfo> lines;
+    instructions.reserve(size);
+    lines.reserve(order.size());
+
+    for(std::uint32_t line : order){
+        new_line[line] = static_cast<std::uint32_t>(lines.size());
+        LineInfo info = program.lines[line];
+        info.first = static_cast<std::uint32_t>(instructions.size());
+        lines.push_back(info);
+        std::uint32_t end = (line + 1 < program.lines.size()) ? program.lines[line + 1].first
+                                                               : size;
+        for(std::uint32_t i = program.lines[line].first; i < end; i++){
+            new_index[i] = static_cast<std::uint32_t>(instructions.size());
+            if(!drop[i]){
+                instructions.push_back(program.instructions[i]);
+            }
+        }
+    }
+
+    auto remap = [&](std::uint32_t index){
+        return (NO_INDEX == index) ? NO_INDEX : new_index[index];
+    };
+    for(Instruction &instruction : instructions){
+        instruction.line = new_line[instruction.line];
+        instruction.target = remap(instruction.target);
+        instruction.alternate = remap(instruction.alternate);
+    }
+    for(SwitchCase &switch_case : program.cases){
+        switch_case.target = remap(switch_case.target);
+    }
+    program.instructions = std::move(instructions);
+    program.lines = std::move(lines);
+}
+
+} // end anonymous namespace
+
+// region: ControlFlowGraph
+
+ControlFlowGraph::ControlFlowGraph(const Program &program)
+    : program_(program), successors_(program.lines.size()), predecessors_(program.lines.size()){
+    for(std::uint32_t line = 0; line < line_count(); line++){
+        for(std::uint32_t i = first(line); i < end(line); i++){
+            const Instruction &instruction = program.instructions[i];
+            std::uint32_t target = instruction.target;
+            if(NO_INDEX != target){
+                std::uint32_t to = program.instructions[target].line;
+                // A test of an IFANY jumping to the body is not an edge.
+                if(to != line || target == first(line)){
+                    add_edge_(line, to, Opcode::CALL == instruction.opcode ? EdgeKind::CALL
+                                                                             : EdgeKind::GOTO, i);
+                }
+            }
+            if(NO_INDEX != instruction.alternate){
+                add_edge_(line, program.instructions[instruction.alternate].line,
+                          EdgeKind::ALTERNATE, i);
+            }
+        }
+        if(falls_through(line) && line + 1 < line_count()){
+            add_edge_(line, line + 1, EdgeKind::FALL_THROUGH, NO_INDEX);
+        }
+    }
+}
+
+void ControlFlowGraph::add_edge_(std::uint32_t from, std::uint32_t to, EdgeKind kind,
+                                 std::uint32_t instruction){
+    Edge edge{from, to, kind, instruction};
+    successors_[from].push_back(edge);
+    predecessors_[to].push_back(edge);
+}
+
+std::uint32_t ControlFlowGraph::end(std::uint32_t line) const noexcept{
+    return (line + 1 < line_count()) ? program_.lines[line + 1].first
+                                     : static_cast<std::uint32_t>(program_.instructions.size());
+}
+
+bool ControlFlowGraph::falls_through(std::uint32_t line) const noexcept{
+    return first(line) == end(line) || !ends_block(program_.instructions[end(line) - 1].opcode);
+}
+
+std::vector<bool> ControlFlowGraph::reachable() const{
+    std::vector<bool> reached(line_count(), false);
+    if(0 == line_count()){
+        return reached;
+    }
+    std::vector<std::uint32_t> pending{0};
+    reached[0] = true;
+    while(!pending.empty()){
+        std::uint32_t line = pending.back();
+        pending.pop_back();
+        for(const Edge &edge : successors_[line]){
+            if(!reached[edge.to]){
+                reached[edge.to] = true;
+                pending.push_back(edge.to);
+            }
+        }
+    }
+    return reached;
+}
+
+std::vector<std::uint32_t> ControlFlowGraph::loop_depths() const{
+    std::vector<std::uint32_t> depths(line_count(), 0);
+    for(std::uint32_t line = 0; line < line_count(); line++){
+        for(const Edge &edge : successors_[line]){
+            if(EdgeKind::GOTO == edge.kind && edge.to <= line){
+                for(std::uint32_t inside = edge.to; inside <= line; inside++){
+                    depths[inside]++;
+                }
+            }
+        }
+    }
+    return depths;
+}
+
+// endregion: ControlFlowGraph
+
+// region: InstructionSuccessors
+
+InstructionSuccessors::InstructionSuccessors(const Program &program) : program_(program){
+    for(std::uint32_t site = 0; site < program.instructions.size(); site++){
+        const Instruction &instruction = program.instructions[site];
+        if(Opcode::CALL == instruction.opcode){
+            done_returns_.push_back(site + 1);
+            fail_returns_.push_back(NO_INDEX == instruction.alternate ? site + 1
+                                                                      : instruction.alternate);
+        }
+    }
+}
+
+void InstructionSuccessors::of(std::uint32_t index, std::vector<std::uint32_t> &successors) const{
+    Instruction instruction = unfused(program_.instructions[index]);
+    successors.clear();
+    switch(instruction.opcode){
+        case Opcode::JUMP:[[fallthrough]];
+        case Opcode::CALL:successors.push_back(instruction.target);
+            break;
+        case Opcode::RETURN_DONE:successors = done_returns_;
+            break;
+        case Opcode::RETURN_FAIL:successors = fail_returns_;
+            break;
+        case Opcode::HALT:break;
+        case Opcode::SWITCH:
+            for(std::uint32_t i = 0; i < instruction.operands[2]; i++){
+                successors.push_back(program_.cases[instruction.operands[3] + i].target);
+            }
+            successors.push_back(instruction.alternate);
+            break;
+        default:
+            if(is_test(instruction.opcode)){
+                successors.push_back(instruction.target);
+            }
+            successors.push_back(index + 1);
+            break;
+    }
+}
+
+// endregion: InstructionSuccessors
+
+std::vector<bool> entry_points(const Program &program){
+    std::vector<bool> entries(program.instructions.size() + 1, false);
+    for(const LineInfo &line : program.lines){
+        if(line.first < entries.size()){
+            entries[line.first] = true;
+        }
+    }
+    for(std::uint32_t i = 0; i < program.instructions.size(); i++){
+        const Instruction &instruction = program.instructions[i];
+        for(std::uint32_t target : {instruction.target, instruction.alternate}){
+            if(target < entries.size()){
+                entries[target] = true;
+            }
+        }
+        if(Opcode::CALL == instruction.opcode){
+            entries[i + 1] = true;
+        }
+    }
+    for(const SwitchCase &switch_case : program.cases){
+        if(switch_case.target < entries.size()){
+            entries[switch_case.target] = true;
+        }
+    }
+    return entries;
+}
+
+// region: Passes
+
+std::size_t thread_jumps(Program &program){
+    std::size_t threaded = 0;
+    auto thread = [&](std::uint32_t &target){
+        std::uint32_t final_target = target;
+        // A chain of GOTOs is at most as long as the program; any longer is a cycle.
+        for(std::size_t steps = 0; NO_INDEX != final_target
+                                   && Opcode::JUMP == program.instructions[final_target].opcode
+                                   && steps < program.instructions.size(); steps++){
+            final_target = program.instructions[final_target].target;
+        }
+        if(final_target != target && NO_INDEX != final_target){
+            target = final_target;
+            threaded++;
+        }
+    };
+    for(Instruction &instruction : program.instructions){
+        thread(instruction.target);
+        thread(instruction.alternate);
+    }
+    return threaded;
+}
+
+std::size_t remove_unreachable_lines(Program &program){
+    std::vector<bool> reached = ControlFlowGraph(program).reachable();
+    std::vector<std::uint32_t> order;
+    for(std::uint32_t line = 0; line < reached.size(); line++){
+        if(reached[line]){
+            order.push_back(line);
+        }
+    }
+    std::size_t removed = program.lines.size() - order.size();
+    if(0 != removed){
+        rebuild(program, order, std::vector<bool>(program.instructions.size(), false));
+    }
+    return removed;
+}
+
+std::size_t lay_out_lines(Program &program){
+    ControlFlowGraph graph(program);
+    std::uint32_t count = graph.line_count();
+    // The layout is a set of chains of lines, linked by `next` and `previous`.
+    std::vector<std::uint32_t> next(count, NO_INDEX);
+    std::vector<std::uint32_t> previous(count, NO_INDEX);
+    for(std::uint32_t line = 0; line + 1 < count; line++){
+        if(graph.falls_through(line)){
+            next[line] = line + 1;
+            previous[line + 1] = line;
+        }
+    }
+
+    // The lines that end in a GOTO to the start of a line, most deeply nested first.
+    std::vector<std::uint32_t> depths = graph.loop_depths();
+    std::vector<std::uint32_t> candidates;
+    for(std::uint32_t line = 0; line < count; line++){
+        if(graph.first(line) < graph.end(line)){
+            const Instruction &last = program.instructions[graph.end(line) - 1];
+            if(Opcode::JUMP == last.opcode
+               && last.target == program.lines[program.instructions[last.target].line].first){
+                candidates.push_back(line);
+            }
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [&](std::uint32_t a, std::uint32_t b){
+        return depths[a] > depths[b];
+    });
+
+    auto head = [&](std::uint32_t line){
+        while(NO_INDEX != previous[line]){
+            line = previous[line];
+        }
+        return line;
+    };
+    std::vector<bool> drop(program.instructions.size(), false);
+    std::size_t dropped = 0;
+    for(std::uint32_t line : candidates){
+        std::uint32_t jump = graph.end(line) - 1;
+        std::uint32_t to = program.instructions[program.instructions[jump].target].line;
+        // The first line stays first, and a chain must not close on itself.
+        if(0 == to || NO_INDEX != next[line] || NO_INDEX != previous[to] || head(line) == to){
+            continue;
+        }
+        next[line] = to;
+        previous[to] = line;
+        drop[jump] = true;
+        dropped++;
+    }
+    if(0 == dropped){
+        return 0;
+    }
+
+    // The chain of the first line, then the others in the order of their first lines.
+    std::vector<std::uint32_t> order;
+    order.reserve(count);
+    for(std::uint32_t line = 0; line < count; line++){
+        if(NO_INDEX == previous[line]){
+            for(std::uint32_t in_chain = line; NO_INDEX != in_chain; in_chain = next[in_chain]){
+                order.push_back(in_chain);
+            }
+        }
+    }
+    rebuild(program, order, drop);
+    return dropped;
+}
+
+void remove_instructions(Program &program, const std::vector<bool> &drop){
+    std::vector<std::uint32_t> order(program.lines.size());
+    for(std::uint32_t line = 0; line < order.size(); line++){
+        order[line] = line;
+    }
+    rebuild(program, order, drop);
+}
+
+void optimize_control_flow(Program &program){
+    thread_jumps(program);
+    remove_unreachable_lines(program);
+    lay_out_lines(program);
+}
+
+// endregion: Passes
+
+} // end namespace elsix
@@ -0,0 +1,171 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The control-flow graph of a lowered program, and the passes that use it.
+ *
+ * The nodes of the graph are the lines of the program. A line falls through to the next when its
+ * last instruction is not a GOTO, DONE, or FAIL, including when it ends in a call, since DONE
+ * returns to the instruction after the call. Tests and GOTOs add edges to the lines they jump to,
+ * and calls add edges to their subroutines and to their FAIL alternates. Jumps within a line, from
+ * a test of an IFANY to its body, are not edges.
+ *
+ * The passes rewrite the program in place:
+ *
+ *  - Jump threading retargets a jump to a line that does nothing but GOTO another line, or a
+ *    chain of such lines, to where the chain ends.
+ *  - Unreachable-line elimination removes the lines no path from the first line reaches.
+ *  - Layout orders the lines so that a line ending in a GOTO is followed by the line it goes to,
+ *    where that does not break a fall-through, so that the GOTO can be dropped. The GOTOs of the
+ *    most deeply nested loops, which are executed most, are placed first. Every back end
+ *    executes or emits the instructions in the order of the program, so all follow the layout.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "program.hpp"
+
+namespace elsix{
+
+enum class EdgeKind: std::uint8_t{
+    FALL_THROUGH,
+    GOTO,       // A GOTO, or a test that jumps.
+    CALL,       // From a call to its subroutine.
+    ALTERNATE   // From a call to where its subroutine's FAIL continues.
+};
+
+struct Edge{
+    std::uint32_t from;
+    std::uint32_t to;
+    EdgeKind kind;
+    // The instruction that jumps, or NO_INDEX for a fall-through.
+    std::uint32_t instruction;
+};
+
+class ControlFlowGraph{
+public:
+    explicit ControlFlowGraph(const Program &program);
+
+    [[nodiscard]] std::uint32_t line_count() const noexcept{
+        return static_cast<std::uint32_t>(successors_.size());
+    }
+
+    [[nodiscard]] const std::vector<Edge> &successors(std::uint32_t line) const noexcept{
+        return successors_[line];
+    }
+
+    [[nodiscard]] const std::vector<Edge> &predecessors(std::uint32_t line) const noexcept{
+        return predecessors_[line];
+    }
+
+    /// Instructions `first(line)` up to but not including `end(line)` make up the line.
+    [[nodiscard]] std::uint32_t first(std::uint32_t line) const noexcept{
+        return program_.lines[line].first;
+    }
+
+    [[nodiscard]] std::uint32_t end(std::uint32_t line) const noexcept;
+
+    /// Does control go on from the end of the line to the next?
+    [[nodiscard]] bool falls_through(std::uint32_t line) const noexcept;
+
+    /// Marks the lines a path from the first line reaches.
+    [[nodiscard]] std::vector<bool> reachable() const;
+
+    /**
+     * @brief The loop depth of each line: the number of GOTOs back to the same or an earlier
+     * line whose loops, from the line jumped to through the line of the GOTO, contain the line.
+     */
+    [[nodiscard]] std::vector<std::uint32_t> loop_depths() const;
+
+private:
+    const Program &program_;
+    std::vector<std::vector<Edge>> successors_;
+    std::vector<std::vector<Edge>> predecessors_;
+
+    void add_edge_(std::uint32_t from, std::uint32_t to, EdgeKind kind, std::uint32_t instruction);
+};
+
+/**
+ * @brief Where each instruction may continue, for analyses that run over instructions rather
+ * than lines. A superinstruction continues as its first part does. DONE and FAIL continue after
+ * every call, or at every FAIL alternate, since which call they return from is not known.
+ */
+class InstructionSuccessors{
+public:
+    explicit InstructionSuccessors(const Program &program);
+
+    /// Sets `successors` to the instructions instruction `index` may continue to.
+    void of(std::uint32_t index, std::vector<std::uint32_t> &successors) const;
+
+private:
+    const Program &program_;
+    std::vector<std::uint32_t> done_returns_;
+    std::vector<std::uint32_t> fail_returns_;
+};
+
+/**
+ * @brief Marks the instructions control can reach other than from the instruction before: the
+ * first instructions of lines, the targets of jumps, calls, FAIL alternates, and SWITCH cases,
+ * and the instructions after calls, where DONE returns.
+ */
+[[nodiscard]] std::vector<bool> entry_points(const Program &program);
+
+/**
+ * @brief Retargets jumps, calls, and FAIL alternates to lines that only GOTO another line.
+ * @return The number of targets changed.
+ */
+std::size_t thread_jumps(Program &program);
+
+/**
+ * @brief Removes the lines control cannot reach.
+ * @return The number of lines removed.
+ */
+std::size_t remove_unreachable_lines(Program &program);
+
+/**
+ * @brief Orders the lines so that GOTOs become fall-throughs, hot lines first.
+ * @return The number of GOTOs dropped.
+ */
+std::size_t lay_out_lines(Program &program);
+
+/**
+ * @brief Removes the instructions marked in `drop`, which control may pass over. What jumped to
+ * one continues at the next instruction kept. No line may lose all its instructions.
+ */
+void remove_instructions(Program &program, const std::vector<bool> &drop);
+
+/// Runs jump threading, unreachable-line elimination, and layout.
+void optimize_control_flow(Program &program);
+
+} // end namespace elsix
@@ -0,0 +1,294 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The conversion operations BZ, ZB, BD, DB, BO, and OB.
+ *
+ * Each operates on a word of ten packed six bit characters (see charset.hpp) or on a binary
+ * number. Rather than loop over the characters, the kernels treat the word as ten six bit lanes
+ * and work on all of them at once with ordinary integer arithmetic, or look up two characters at
+ * a time in small tables. The character set is a template parameter, so the constants and tables
+ * are fixed at compile time. The `_reference` versions are straightforward loops that define what
+ * the kernels must compute.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "field.hpp"
+#include "charset.hpp"
+
+namespace elsix{
+
+/// The number of decimal or octal digits a conversion produces or consumes.
+constexpr unsigned CONVERSION_DIGITS = CHARACTERS_PER_WORD;
+
+/// The ten character lanes of a word.
+constexpr Word CHARACTER_LANES = (Word{1} << (CONVERSION_DIGITS * CHARACTER_BITS)) - 1;
+
+/// The even numbered lanes, and the even numbered pairs of lanes, counting from the low order.
+constexpr Word EVEN_LANES = 0x03F03F03F03F03FULL;
+constexpr Word EVEN_PAIRS = 0x0FFF000FFF000FFFULL;
+/// The low order bit of each even numbered lane, and the bit just above it.
+constexpr Word EVEN_ONES = 0x001001001001001ULL;
+constexpr Word EVEN_GUARDS = EVEN_LANES + EVEN_ONES;
+
+/// Repeats a six bit code in every lane.
+constexpr Word broadcast(Word code) noexcept{
+    Word lanes = 0;
+    for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+        lanes |= code << (lane * CHARACTER_BITS);
+    }
+    return lanes;
+}
+
+/**
+ * @brief The high bit of each lane of `characters` that is not equal to `code`. Adding 37 (octal)
+ * to the low five bits of a lane carries into its high bit exactly when they are not all zero, and
+ * never into the next lane.
+ */
+constexpr Word lanes_not_equal(Word characters, Word code) noexcept{
+    constexpr Word low_bits = broadcast(037);
+    constexpr Word high_bits = broadcast(040);
+    Word difference = characters ^ broadcast(code);
+    return (((difference & low_bits) + low_bits) | difference) & high_bits;
+}
+
+/**
+ * @brief Each lane of `characters` less `zero`, or 0 where the lane is below `zero`, as a blank
+ * is in ASCII. The even and odd lanes are done apart, so that each has the lane above it free
+ * for a guard bit: the guard survives subtracting `zero` exactly when the lane is not below it,
+ * and no lane borrows from the next.
+ */
+constexpr Word lane_digits(Word characters, Word zero) noexcept{
+    auto even_digits = [zero](Word lanes){
+        Word guarded = ((lanes & EVEN_LANES) | EVEN_GUARDS) - zero * EVEN_ONES;
+        Word kept = ((guarded & EVEN_GUARDS) >> CHARACTER_BITS) * CHARACTER_MASK;
+        return guarded & kept;
+    };
+    return even_digits(characters) | even_digits(characters >> CHARACTER_BITS) << CHARACTER_BITS;
+}
+
+/**
+ * @brief Tables converting two digits at a time, generated for each character set.
+ */
+template<const CharacterSet &Characters>
+struct ConversionTables{
+    /// The two character decimal representation of 0 through 99.
+    static constexpr std::array<std::uint16_t, 100> decimal_pairs = [](){
+        std::array<std::uint16_t, 100> pairs{};
+        for(unsigned n = 0; n < 100; n++){
+            pairs[n] = static_cast<std::uint16_t>(((Characters.zero + n / 10) << CHARACTER_BITS)
+                                                  | (Characters.zero + n % 10));
+        }
+        return pairs;
+    }();
+
+    /// The two character octal representation of 0 through 63.
+    static constexpr std::array<std::uint16_t, 64> octal_pairs = [](){
+        std::array<std::uint16_t, 64> pairs{};
+        for(unsigned n = 0; n < 64; n++){
+            pairs[n] = static_cast<std::uint16_t>(((Characters.zero + n / 8) << CHARACTER_BITS)
+                                                  | (Characters.zero + n % 8));
+        }
+        return pairs;
+    }();
+};
+
+// region: Kernels
+
+/// Implements `(a, BZ, c)`: every blank becomes a zero.
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word blanks_to_zeroes(Word characters) noexcept{
+    characters &= CHARACTER_LANES;
+    Word blank_lanes = ~lanes_not_equal(characters, Characters.blank) & broadcast(040);
+    // Widen the high bit of each blank lane to the whole lane.
+    Word blanks = (blank_lanes >> (CHARACTER_BITS - 1)) * CHARACTER_MASK;
+    return (characters & ~blanks) | (broadcast(Characters.zero) & blanks);
+}
+
+/// Implements `(a, ZB, c)`: leading zeroes become blanks. The last character is kept, so that
+/// zero converts to a single 0.
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word zeroes_to_blanks(Word characters) noexcept{
+    characters &= CHARACTER_LANES;
+    Word significant = lanes_not_equal(characters, Characters.zero) | 040;
+    // Everything above the lane of the first significant character is a leading zero.
+    unsigned highest = WORD_BITS - 1 - static_cast<unsigned>(__builtin_clzll(significant));
+    Word leading = CHARACTER_LANES & ~((Word{2} << highest) - 1);
+    return (characters & ~leading) | (broadcast(Characters.blank) & leading);
+}
+
+/// Implements `(a, BD, c)`: the low order ten decimal digits of `value`. Division by a constant
+/// compiles to a multiply and shift; each quotient below 100 is then two characters from a table.
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word binary_to_decimal(Word value) noexcept{
+    constexpr auto &pairs = ConversionTables<Characters>::decimal_pairs;
+    value %= 10000000000ULL;
+    auto high = static_cast<std::uint32_t>(value / 100000);
+    auto low = static_cast<std::uint32_t>(value % 100000);
+    // Ten digits are the five digits of each half: one digit and two pairs.
+    std::uint32_t high_pairs = high % 10000;
+    std::uint32_t low_pairs = low % 10000;
+    return (static_cast<Word>(Characters.zero + high / 10000) << 54)
+         | (static_cast<Word>(pairs[high_pairs / 100]) << 42)
+         | (static_cast<Word>(pairs[high_pairs % 100]) << 30)
+         | (static_cast<Word>(Characters.zero + low / 10000) << 24)
+         | (static_cast<Word>(pairs[low_pairs / 100]) << 12)
+         | static_cast<Word>(pairs[low_pairs % 100]);
+}
+
+/// Implements `(a, DB, c)`: the value of ten decimal digits, where a character below zero, such
+/// as an ASCII blank, counts as 0. Adjacent digits are combined in parallel, pairs first and then
+/// pairs of pairs, in three multiplies.
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word decimal_to_binary(Word characters) noexcept{
+    Word digits = lane_digits(characters, Characters.zero);
+    // Each twelve bit chunk becomes 10 * its high digit + its low digit.
+    Word pairs = (digits & EVEN_LANES) + ((digits >> CHARACTER_BITS) & EVEN_LANES) * 10;
+    // Each twenty four bit chunk becomes 100 * its high pair + its low pair.
+    Word quads = (pairs & EVEN_PAIRS) + ((pairs >> 12) & EVEN_PAIRS) * 100;
+    return (quads & 0xFFFFFF)
+         + ((quads >> 24) & 0xFFFFFF) * 10000
+         + (quads >> 48) * 100000000;
+}
+
+/// Implements `(a, BO, c)`: the low order ten octal digits of `value`.
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word binary_to_octal(Word value) noexcept{
+    constexpr Word digit_bits = broadcast(07);
+#if defined(__BMI2__)
+    return _pdep_u64(value, digit_bits) + broadcast(Characters.zero);
+#else
+    static_cast<void>(digit_bits);
+    constexpr auto &pairs = ConversionTables<Characters>::octal_pairs;
+    return (static_cast<Word>(pairs[(value >> 24) & 077]) << 48)
+         | (static_cast<Word>(pairs[(value >> 18) & 077]) << 36)
+         | (static_cast<Word>(pairs[(value >> 12) & 077]) << 24)
+         | (static_cast<Word>(pairs[(value >> 6) & 077]) << 12)
+         | static_cast<Word>(pairs[value & 077]);
+#endif
+}
+
+/// Implements `(a, OB, c)`: the value of ten octal digits, where a character below zero counts
+/// as 0, as for DB.
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word octal_to_binary(Word characters) noexcept{
+    constexpr Word digit_bits = broadcast(07);
+    Word digits = lane_digits(characters, Characters.zero) & digit_bits;
+#if defined(__BMI2__)
+    return _pext_u64(digits, digit_bits);
+#else
+    // Close up the gaps between digits in two steps, as for decimal.
+    Word pairs = (digits & EVEN_LANES) | ((digits >> CHARACTER_BITS) & EVEN_LANES) << 3;
+    Word quads = (pairs & EVEN_PAIRS) | ((pairs >> 12) & EVEN_PAIRS) << 6;
+    return (quads & 07777) | ((quads >> 24) & 07777) << 12 | (quads >> 48) << 24;
+#endif
+}
+
+// endregion: Kernels
+
+// region: Reference implementations
+
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word blanks_to_zeroes_reference(Word characters) noexcept{
+    Word result = 0;
+    for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+        Word code = (characters >> (lane * CHARACTER_BITS)) & CHARACTER_MASK;
+        if(Characters.blank == code){
+            code = Characters.zero;
+        }
+        result |= code << (lane * CHARACTER_BITS);
+    }
+    return result;
+}
+
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word zeroes_to_blanks_reference(Word characters) noexcept{
+    Word result = characters & CHARACTER_LANES;
+    for(unsigned lane = CONVERSION_DIGITS - 1; lane > 0; lane--){
+        unsigned shift = lane * CHARACTER_BITS;
+        if(Characters.zero != ((result >> shift) & CHARACTER_MASK)){
+            break;
+        }
+        result = (result & ~(CHARACTER_MASK << shift)) | (Word{Characters.blank} << shift);
+    }
+    return result;
+}
+
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word binary_to_decimal_reference(Word value) noexcept{
+    Word result = 0;
+    for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+        result |= (Characters.zero + value % 10) << (lane * CHARACTER_BITS);
+        value /= 10;
+    }
+    return result;
+}
+
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word decimal_to_binary_reference(Word characters) noexcept{
+    Word value = 0;
+    for(unsigned lane = CONVERSION_DIGITS; lane > 0; lane--){
+        Word code = (characters >> ((lane - 1) * CHARACTER_BITS)) & CHARACTER_MASK;
+        value = value * 10 + ((code < Characters.zero) ? 0 : code - Characters.zero);
+    }
+    return value;
+}
+
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word binary_to_octal_reference(Word value) noexcept{
+    Word result = 0;
+    for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+        result |= (Characters.zero + (value & 07)) << (lane * CHARACTER_BITS);
+        value >>= 3;
+    }
+    return result;
+}
+
+template<const CharacterSet &Characters = DEFAULT_CHARACTERS>
+Word octal_to_binary_reference(Word characters) noexcept{
+    Word value = 0;
+    for(unsigned lane = CONVERSION_DIGITS; lane > 0; lane--){
+        Word code = (characters >> ((lane - 1) * CHARACTER_BITS)) & CHARACTER_MASK;
+        value = (value << 3) | ((code < Characters.zero) ? 0 : (code - Characters.zero) & 07);
+    }
+    return value;
+}
+
+// endregion: Reference implementations
+
+} // end namespace elsix
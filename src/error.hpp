@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <iosfwd>
 #include <vector>
 #include <string>
@@ -51,7 +52,7 @@ enum class ErrorType{
 struct Error{
     Error(const std::string &&msg, Span spn);
     const Span span;
-    const std::string &message;
+    const std::string message;
 };
 
 using ErrorVector = std::vector<Error>;
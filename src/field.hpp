@@ -0,0 +1,194 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Defines the machine `Word` and the `FieldDefinition` structure that locates a named
+ * field within a block.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace elsix{
+
+/**
+ * @brief A machine word. We use machine sized words rather than the 36 bits of the 7094 or the 48
+ * bits of the Atlas. Addresses, bug contents, and field contents are all `Word`s.
+ */
+using Word = std::uint64_t;
+
+constexpr unsigned WORD_BITS = 64;
+
+/**
+ * @brief A double word, used to extract and insert fields that straddle a word boundary.
+ */
+__extension__ using DoubleWord = unsigned __int128;
+
+/// A field may be up to two words wide.
+constexpr unsigned MAX_FIELD_BITS = 2 * WORD_BITS;
+
+/**
+ * @brief How a field sits within its block, determined once when the field is defined.
+ */
+enum class FieldLayout: std::uint8_t{
+    ALIGNED,    // Within one word and right justified: a load and a mask.
+    UNALIGNED,  // Within one word: a load, a shift, and a mask.
+    STRADDLING  // Crosses into the next word: two loads combined into a double word.
+};
+
+/**
+ * @brief A field definition as established by `(cd1, Df, cd2, cd3)`: field `f` occupies bits
+ * `cd2` through `cd3` of word `cd1` of a block.
+ *
+ * Following Knowlton, bits are numbered from the most significant (bit 0) to the least
+ * significant (bit 63). Bit numbers continue into the following words, so that bit 64 of word
+ * `n` is bit 0 of word `n + 1`. A field is at most 128 bits wide and so lies within at most two
+ * words. The layout, shift, and mask are computed once at definition time so that reading or
+ * writing a field that lies within one word is a single load, shift, and mask.
+ */
+struct FieldDefinition{
+    FieldDefinition() = default;
+    explicit FieldDefinition(unsigned word, unsigned first_bit, unsigned last_bit){
+        // Normalize so that the field begins in the first word.
+        word += first_bit / WORD_BITS;
+        last_bit -= first_bit / WORD_BITS * WORD_BITS;
+        first_bit %= WORD_BITS;
+        unsigned bits = (last_bit < first_bit) ? 0 : last_bit - first_bit + 1;
+
+        this->word = word;
+        this->width = static_cast<std::uint8_t>(bits);
+        mask = (bits >= WORD_BITS) ? ~Word{0} : (Word{1} << bits) - 1;
+        if(0 == bits){
+            // An empty field reads as zero and ignores writes.
+            shift = 0;
+            layout = FieldLayout::ALIGNED;
+        } else if(last_bit < WORD_BITS){
+            shift = static_cast<std::uint8_t>(WORD_BITS - 1 - last_bit);
+            layout = (0 == shift) ? FieldLayout::ALIGNED : FieldLayout::UNALIGNED;
+        } else{
+            shift = static_cast<std::uint8_t>(MAX_FIELD_BITS - 1 - last_bit);
+            layout = FieldLayout::STRADDLING;
+        }
+    }
+
+    /// Can `(cd1, Df, cd2, cd3)` define a field with these bit numbers?
+    [[nodiscard]] static bool valid(unsigned first_bit, unsigned last_bit) noexcept{
+        return last_bit < first_bit / WORD_BITS * WORD_BITS + MAX_FIELD_BITS
+            && last_bit + 1 - first_bit <= MAX_FIELD_BITS;
+    }
+
+    /// The field value of the block beginning at `block`, right aligned. Only the low order word
+    /// of a field wider than a word is returned; see `load_wide()`.
+    [[nodiscard]] Word load(const Word *block) const noexcept{
+        if(FieldLayout::STRADDLING == layout){
+            return static_cast<Word>(load_straddling(block));
+        }
+        return (block[word] >> shift) & mask;
+    }
+
+    /// Writes the low order bits of `value` into the field of the block beginning at `block`.
+    void store(Word *block, Word value) const noexcept{
+        if(FieldLayout::STRADDLING == layout){
+            store_straddling(block, value);
+            return;
+        }
+        block[word] = (block[word] & ~(mask << shift)) | ((value & mask) << shift);
+    }
+
+    /// The full value of a field of up to two words.
+    [[nodiscard]] DoubleWord load_wide(const Word *block) const noexcept{
+        if(FieldLayout::STRADDLING == layout){
+            return load_straddling(block);
+        }
+        return (block[word] >> shift) & mask;
+    }
+
+    /// Writes the low order bits of a value of up to two words into the field.
+    void store_wide(Word *block, DoubleWord value) const noexcept{
+        if(FieldLayout::STRADDLING == layout){
+            store_straddling(block, value);
+            return;
+        }
+        store(block, static_cast<Word>(value));
+    }
+
+    // region: Specialized accessors
+    // Callers that know the layout of a field in advance, such as compiled code, can use these
+    // directly and skip the layout test.
+
+    [[nodiscard]] Word load_aligned(const Word *block) const noexcept{
+        return block[word] & mask;
+    }
+
+    [[nodiscard]] Word load_unaligned(const Word *block) const noexcept{
+        return (block[word] >> shift) & mask;
+    }
+
+    [[nodiscard]] DoubleWord load_straddling(const Word *block) const noexcept{
+        DoubleWord pair = (static_cast<DoubleWord>(block[word]) << WORD_BITS) | block[word + 1];
+        return (pair >> shift) & wide_mask();
+    }
+
+    void store_straddling(Word *block, DoubleWord value) const noexcept{
+        DoubleWord pair = (static_cast<DoubleWord>(block[word]) << WORD_BITS) | block[word + 1];
+        pair = (pair & ~(wide_mask() << shift)) | ((value & wide_mask()) << shift);
+        block[word] = static_cast<Word>(pair >> WORD_BITS);
+        block[word + 1] = static_cast<Word>(pair);
+    }
+
+    // endregion: Specialized accessors
+
+    /// The number of words of a block the field reaches into: those up to its word, and the
+    /// next word too if it straddles.
+    [[nodiscard]] Word extent() const noexcept{
+        return Word{word} + ((FieldLayout::STRADDLING == layout) ? 2 : 1);
+    }
+
+    /// A right aligned mask of the width of the field, which may be up to two words.
+    [[nodiscard]] DoubleWord wide_mask() const noexcept{
+        return (width >= MAX_FIELD_BITS)
+               ? ~DoubleWord{0}
+               : (DoubleWord{1} << width) - 1;
+    }
+
+    // The (first) word within the block.
+    std::uint32_t word = 0;
+    // The number of bits to the right of the field within its word, or within the double word
+    // for a straddling field.
+    std::uint8_t shift = 0;
+    // The number of bits in the field, up to 128.
+    std::uint8_t width = 0;
+    FieldLayout layout = FieldLayout::ALIGNED;
+    // A right aligned mask of the low order word of the field.
+    Word mask = 0;
+};
+
+} // end namespace elsix
@@ -0,0 +1,140 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <array>
+
+#include "fieldconstants.hpp"
+#include "controlflow.hpp"
+#include "fusion.hpp"
+
+namespace elsix{
+
+FieldConstants::FieldConstants(const Program &program)
+    : program_(program), states_(program.instructions.size() * FIELD_COUNT, UNREACHED){
+    solve_();
+}
+
+void FieldConstants::solve_(){
+    if(program_.instructions.empty()){
+        return;
+    }
+    std::array<State, FIELD_COUNT> entry;
+    entry.fill(UNDEFINED);
+    merge_(0, entry.data());
+
+    std::vector<std::uint32_t> pending{0};
+    std::vector<bool> is_pending(program_.instructions.size(), false);
+    is_pending[0] = true;
+    InstructionSuccessors next(program_);
+    std::vector<std::uint32_t> successors;
+    while(!pending.empty()){
+        std::uint32_t index = pending.back();
+        pending.pop_back();
+        is_pending[index] = false;
+
+        // A superinstruction is analysed as its first part, which continues to its second.
+        Instruction instruction = unfused(program_.instructions[index]);
+        std::array<State, FIELD_COUNT> out;
+        for(unsigned field = 0; field < FIELD_COUNT; field++){
+            out[field] = transfer_(instruction, field, states_[index * FIELD_COUNT + field]);
+        }
+
+        next.of(index, successors);
+        for(std::uint32_t successor : successors){
+            if(successor < program_.instructions.size() && merge_(successor, out.data())
+               && !is_pending[successor]){
+                is_pending[successor] = true;
+                pending.push_back(successor);
+            }
+        }
+    }
+}
+
+FieldConstants::State FieldConstants::transfer_(const Instruction &instruction, unsigned field,
+                                                State state){
+    if(instruction.field != field){
+        return state;
+    }
+    if(Opcode::RESTORE_FIELD_DEFINITION == instruction.opcode){
+        return VARYING;
+    }
+    if(Opcode::DEFINE_FIELD != instruction.opcode){
+        return state;
+    }
+    std::array<Word, 3> operands{};
+    for(unsigned i = 0; i < 3; i++){
+        const Operand &operand = program_.operand(instruction, i);
+        if(OperandKind::LITERAL != operand.kind){
+            return VARYING;
+        }
+        operands[i] = operand.value;
+    }
+    // As `Runtime::define_field` checks; a definition that faults defines nothing.
+    if(operands[0] > 0xffff || operands[1] > 0xffff || operands[2] > 0xffff
+       || !FieldDefinition::valid(static_cast<unsigned>(operands[1]),
+                                  static_cast<unsigned>(operands[2]))){
+        return state;
+    }
+    return intern_(FieldDefinition(static_cast<unsigned>(operands[0]),
+                                   static_cast<unsigned>(operands[1]),
+                                   static_cast<unsigned>(operands[2])));
+}
+
+FieldConstants::State FieldConstants::intern_(const FieldDefinition &definition){
+    for(std::size_t i = 0; i < definitions_.size(); i++){
+        const FieldDefinition &known = definitions_[i];
+        if(known.word == definition.word && known.shift == definition.shift
+           && known.mask == definition.mask && known.layout == definition.layout){
+            return static_cast<State>(CONSTANT + i);
+        }
+    }
+    if(CONSTANT + definitions_.size() > 0xffff){
+        return VARYING;
+    }
+    definitions_.push_back(definition);
+    return static_cast<State>(CONSTANT + definitions_.size() - 1);
+}
+
+bool FieldConstants::merge_(std::uint32_t instruction, const State *in){
+    bool changed = false;
+    State *states = &states_[instruction * FIELD_COUNT];
+    for(unsigned field = 0; field < FIELD_COUNT; field++){
+        State merged = (UNREACHED == states[field] || in[field] == states[field]) ? in[field]
+                       : (UNREACHED == in[field]) ? states[field]
+                       : VARYING;
+        if(merged != states[field]){
+            states[field] = merged;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+} // end namespace elsix
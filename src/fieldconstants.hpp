@@ -0,0 +1,93 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief A dataflow analysis that proves which field definitions are constant where.
+ *
+ * Most programs define their fields once at the top with literal operands, as in
+ * `(1, DD, 0, 23) (2, DA, 0, 23)`, and never define them again. Wherever a field is known to
+ * have one definition, a back end can access it with the word, shift, and mask of that definition
+ * as constants instead of looking the definition up. Only where a Df with operands that are not
+ * literals, a second Df of the field, or an FD restore may come first does the access have to
+ * stay dynamic.
+ *
+ * The analysis runs forward over the instructions of the program rather than over the lines of
+ * its `ControlFlowGraph`, since a Df can come between two accesses on one line. At the start of
+ * each instruction each field is unreached, undefined, defined as one particular field, or
+ * varying, meaning it may be defined differently, or not at all, from one execution to another.
+ * DONE and FAIL return to every call site, which is safe whichever call they return from.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "field.hpp"
+#include "program.hpp"
+
+namespace elsix{
+
+class FieldConstants{
+public:
+    explicit FieldConstants(const Program &program);
+
+    /**
+     * @brief The definition field `field` has whenever instruction `instruction` begins, or null
+     * if it may not have the same one every time.
+     */
+    [[nodiscard]] const FieldDefinition *constant(std::uint32_t instruction,
+                                                  unsigned field) const noexcept{
+        State state = states_[instruction * FIELD_COUNT + field];
+        return (state >= CONSTANT) ? &definitions_[state - CONSTANT] : nullptr;
+    }
+
+private:
+    using State = std::uint16_t;
+    static constexpr State UNREACHED = 0;
+    static constexpr State UNDEFINED = 1;
+    static constexpr State VARYING = 2;
+    // `CONSTANT + i` is defined as `definitions_[i]`.
+    static constexpr State CONSTANT = 3;
+
+    const Program &program_;
+    std::vector<FieldDefinition> definitions_;
+    // The state of each field at the start of each instruction, FIELD_COUNT per instruction.
+    std::vector<State> states_;
+
+    void solve_();
+    /// The state of `field` after `instruction`, given its state before.
+    [[nodiscard]] State transfer_(const Instruction &instruction, unsigned field, State state);
+    [[nodiscard]] State intern_(const FieldDefinition &definition);
+    /// Merges `in` into the states at the start of `instruction`. Returns true if they changed.
+    bool merge_(std::uint32_t instruction, const State *in);
+};
+
+} // end namespace elsix
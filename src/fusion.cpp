@@ -0,0 +1,234 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <array>
+
+#include "fusion.hpp"
+#include "controlflow.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// The longest sequence `SequenceMiner` counts.
+constexpr std::uint32_t LONGEST_SEQUENCE = 3;
+
+bool same_operand(const Program &program, const Operand &a, const Operand &b){
+    if(a.kind != b.kind || a.bug != b.bug || a.length != b.length || a.value != b.value){
+        return false;
+    }
+    for(unsigned i = 0; i < a.length; i++){
+        if(program.paths[a.path + i] != program.paths[b.path + i]){
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Makes `first` a superinstruction of it and `second`, if there is one.
+bool fuse_pair(const Program &program, Instruction &first, const Instruction &second){
+    if(is_test(first.opcode)){
+        Opcode fused;
+        switch(second.opcode){
+            case Opcode::RETURN_DONE:fused = Opcode::TEST_OR_DONE;
+                break;
+            case Opcode::RETURN_FAIL:fused = Opcode::TEST_OR_FAIL;
+                break;
+            case Opcode::INTERCHANGE:
+                if(!same_operand(program, program.operand(first, 0), program.operand(second, 0))
+                   || !same_operand(program, program.operand(first, 1),
+                                    program.operand(second, 1))){
+                    return false;
+                }
+                fused = Opcode::TEST_OR_INTERCHANGE;
+                break;
+            default:return false;
+        }
+        first.field = static_cast<std::uint8_t>(first.opcode);
+        first.opcode = fused;
+        return true;
+    }
+
+    if(Opcode::GET_BLOCK == first.opcode
+       && (Opcode::POINT == second.opcode || Opcode::SET_EQUAL == second.opcode)
+       && 2 == second.operand_count){
+        const Operand &block = program.operand(first, 0);
+        const Operand &source = program.operand(second, 1);
+        if(OperandKind::BUG != block.kind || OperandKind::BUG != source.kind
+           || block.bug != source.bug){
+            return false;
+        }
+        first.opcode = Opcode::GET_BLOCK_AND_LINK;
+        first.operands[3] = second.operands[0];
+        return true;
+    }
+    return false;
+}
+
+/// Makes `instruction` FOLLOW_LINK if it is `(X, P, XA)`.
+bool follow_link(const Program &program, Instruction &instruction){
+    if((Opcode::POINT != instruction.opcode && Opcode::SET_EQUAL != instruction.opcode)
+       || 2 != instruction.operand_count){
+        return false;
+    }
+    const Operand &bug = program.operand(instruction, 0);
+    const Operand &link = program.operand(instruction, 1);
+    if(OperandKind::BUG != bug.kind || OperandKind::FIELD != link.kind || 1 != link.length
+       || bug.bug != link.bug){
+        return false;
+    }
+    instruction.opcode = Opcode::FOLLOW_LINK;
+    instruction.field = program.paths[link.path];
+    return true;
+}
+
+/**
+ * @brief The shape of the instructions `first` onward, in which bugs are renamed `a`, `b`, ...
+ * and fields `A`, `B`, ... in the order they appear, and literals other than zero are `#`. So
+ * `(X, P, XA)` and `(Y, P, YD)` have the same shape, `P a, aA`.
+ */
+std::string shape(const Program &program, std::uint32_t first, std::uint32_t count){
+    std::array<char, BUG_NAME_COUNT> bugs{};
+    std::array<char, FIELD_COUNT> fields{};
+    char next_bug = 'a';
+    char next_field = 'A';
+    std::string text;
+    for(std::uint32_t index = first; index < first + count; index++){
+        const Instruction &instruction = program.instructions[index];
+        if(!text.empty()){
+            text += "; ";
+        }
+        if(is_test(instruction.opcode)){
+            text += (0 != (instruction.flags & INVERT)) ? "IF !" : "IF ";
+        }
+        text += mnemonic(instruction.opcode);
+        for(unsigned i = 0; i < instruction.operand_count; i++){
+            const Operand &operand = program.operand(instruction, i);
+            text += (0 == i) ? " " : ", ";
+            switch(operand.kind){
+                case OperandKind::LITERAL:text += (0 == operand.value) ? "0" : "#";
+                    break;
+                case OperandKind::BUG:[[fallthrough]];
+                case OperandKind::FIELD:
+                    if(0 == bugs[operand.bug]){
+                        bugs[operand.bug] = next_bug++;
+                    }
+                    text += bugs[operand.bug];
+                    for(unsigned j = 0; j < operand.length; j++){
+                        char &field = fields[program.paths[operand.path + j]];
+                        if(0 == field){
+                            field = next_field++;
+                        }
+                        text += field;
+                    }
+                    break;
+                default:text += program.operand_name(operand);
+                    break;
+            }
+        }
+    }
+    return text;
+}
+
+} // end anonymous namespace
+
+std::size_t fuse(Program &program){
+    std::vector<bool> entries = entry_points(program);
+    std::size_t fused = 0;
+    auto size = static_cast<std::uint32_t>(program.instructions.size());
+    for(std::uint32_t i = 0; i < size; i++){
+        Instruction &instruction = program.instructions[i];
+        if(i + 1 < size && !entries[i + 1] && program.instructions[i + 1].line == instruction.line
+           && fuse_pair(program, instruction, program.instructions[i + 1])){
+            fused++;
+            // The next instruction is part of this one now.
+            i++;
+        } else if(follow_link(program, instruction)){
+            fused++;
+        }
+    }
+    return fused;
+}
+
+Instruction unfused(const Instruction &instruction) noexcept{
+    Instruction first = instruction;
+    switch(instruction.opcode){
+        case Opcode::TEST_OR_DONE:[[fallthrough]];
+        case Opcode::TEST_OR_FAIL:[[fallthrough]];
+        case Opcode::TEST_OR_INTERCHANGE:
+            first.opcode = static_cast<Opcode>(instruction.field);
+            first.field = 0;
+            break;
+        case Opcode::FOLLOW_LINK:
+            first.opcode = Opcode::POINT;
+            first.field = 0;
+            break;
+        case Opcode::GET_BLOCK_AND_LINK:
+            first.opcode = Opcode::GET_BLOCK;
+            break;
+        default:break;
+    }
+    return first;
+}
+
+// region: SequenceMiner
+
+void SequenceMiner::add(const Program &program){
+    auto size = static_cast<std::uint32_t>(program.instructions.size());
+    for(std::uint32_t first = 0; first < size; first++){
+        std::uint32_t line = program.instructions[first].line;
+        for(std::uint32_t count = 1; count < LONGEST_SEQUENCE && first + count < size; count++){
+            // A sequence stays within a line, and only its last instruction may end a block.
+            const Instruction &last = program.instructions[first + count - 1];
+            if(ends_block(last.opcode) || program.instructions[first + count].line != line){
+                break;
+            }
+            sequences_[shape(program, first, count + 1)]++;
+        }
+    }
+}
+
+std::vector<std::pair<std::string, std::size_t>> SequenceMiner::frequent(std::size_t count) const{
+    std::vector<std::pair<std::string, std::size_t>> sequences(sequences_.begin(),
+                                                                sequences_.end());
+    auto more_frequent = [](const auto &a, const auto &b){
+        return a.second > b.second || (a.second == b.second && a.first < b.first);
+    };
+    count = std::min(count, sequences.size());
+    std::partial_sort(sequences.begin(), sequences.begin() + static_cast<std::ptrdiff_t>(count),
+                      sequences.end(), more_frequent);
+    sequences.resize(count);
+    return sequences;
+}
+
+// endregion: SequenceMiner
+
+} // end namespace elsix
@@ -0,0 +1,85 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Superinstructions: fusing the instruction sequences L6 programs use most.
+ *
+ * A handful of line shapes account for most of the instructions a typical program executes:
+ * `IF (XA, E, 0) THEN DONE` at the end of a list walk, the pointer advance `(X, P, XA)` and its
+ * abbreviation `(X, A)`, the compare-and-swap `IF (XB, L, XDB) THEN (XB, IC, XDB)` of a sort, and
+ * the list insertion `(W, GT, n, WA) (WAD, P, W)`. Fusion rewrites each such sequence into a
+ * single superinstruction, so that the interpreter dispatches once where it dispatched twice and
+ * decodes the operands the sequence shares once.
+ *
+ * A superinstruction replaces the first instruction of its sequence; the second stays where it
+ * was, so that jump targets keep their indices, and `unfused()` recovers the first. The JIT
+ * compiles the two separately, and leaving compiled code at the second continues there. The C++
+ * translator expects a program that has not been fused, since the C++ compiler does better.
+ *
+ * Which sequences are worth fusing is a matter of measurement. `SequenceMiner` counts the
+ * sequences of a corpus of programs by their shape, and the shapes it finds most often are the
+ * candidates for new superinstructions.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "program.hpp"
+
+namespace elsix{
+
+/**
+ * @brief Fuses the sequences of `program` that have superinstructions.
+ * @return The number of superinstructions made.
+ */
+std::size_t fuse(Program &program);
+
+/// The first instruction of the sequence a superinstruction was made of, or `instruction` itself.
+[[nodiscard]] Instruction unfused(const Instruction &instruction) noexcept;
+
+class SequenceMiner{
+public:
+    /// Counts the sequences of two and of three instructions within the lines of `program`.
+    void add(const Program &program);
+
+    /// The `count` most frequent sequences, most frequent first, with how often each occurs.
+    [[nodiscard]] std::vector<std::pair<std::string, std::size_t>>
+    frequent(std::size_t count) const;
+
+private:
+    std::unordered_map<std::string, std::size_t> sequences_;
+};
+
+} // end namespace elsix
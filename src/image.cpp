@@ -0,0 +1,321 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+#include <vector>
+
+#include "image.hpp"
+
+namespace elsix{
+
+namespace{
+
+constexpr std::size_t IMAGE_ALIGNMENT = 8;
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/// FNV-1a taken a word at a time rather than a byte, with a shift to carry high bits down.
+std::uint64_t checksum(const unsigned char *data, std::size_t bytes) noexcept{
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for(std::size_t i = 0; i + IMAGE_ALIGNMENT <= bytes; i += IMAGE_ALIGNMENT){
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ULL;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+/// The header an image written by this Elsix has, but for the length, checksum, and sections.
+ImageHeader expected_header() noexcept{
+    ImageHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = IMAGE_MAGIC;
+    header.version = IMAGE_VERSION;
+    header.opcode_count = static_cast<std::uint8_t>(Opcode::OPCODE_COUNT);
+    header.instruction_bytes = sizeof(Instruction);
+    header.operand_bytes = sizeof(Operand);
+    header.line_bytes = sizeof(LineInfo);
+    header.case_bytes = sizeof(SwitchCase);
+    header.byte_order = BYTE_ORDER_MARK;
+    return header;
+}
+
+template<typename Record>
+void append_section(std::string &image, ImageHeader &header, ImageSectionIndex section,
+                    const Record *records, std::size_t count){
+    static_assert(std::is_trivially_copyable<Record>::value, "Images hold records as they are.");
+    header.sections[section] = {image.size(), count};
+    image.append(reinterpret_cast<const char *>(records), count * sizeof(Record));
+    image.resize((image.size() + IMAGE_ALIGNMENT - 1) / IMAGE_ALIGNMENT * IMAGE_ALIGNMENT, '\0');
+}
+
+/// Does the section lie within an image of `bytes` bytes?
+bool contains(std::size_t bytes, const ImageSection &section, std::size_t record_bytes) noexcept{
+    return section.offset <= bytes && section.count <= (bytes - section.offset) / record_bytes;
+}
+
+template<typename Record>
+bool copy_section(const unsigned char *image, std::size_t bytes, const ImageHeader &header,
+                  ImageSectionIndex section, std::vector<Record> &records){
+    const ImageSection &found = header.sections[section];
+    if(!contains(bytes, found, sizeof(Record))){
+        return false;
+    }
+    records.resize(found.count);
+    std::memcpy(static_cast<void *>(records.data()), image + found.offset,
+                found.count * sizeof(Record));
+    return true;
+}
+
+/// Are the `count` records from `first` on within an array of `size`?
+bool within(std::uint64_t first, std::uint64_t count, std::size_t size) noexcept{
+    return first <= size && count <= size - first;
+}
+
+/// Does operand 3 of a Get Chain pack a link field and an optional back link, each plus one?
+bool chain_fields_valid(const Program &program, const Instruction &instruction) noexcept{
+    if(4 != instruction.operand_count){
+        return false;
+    }
+    const Operand &fields = program.operand(instruction, 3);
+    Word link = fields.value & 0xff;
+    Word back_link = (fields.value >> 8) & 0xff;
+    return OperandKind::LITERAL == fields.kind && 0 == (fields.value >> 16)
+           && 0 != link && link <= FIELD_COUNT && back_link <= FIELD_COUNT;
+}
+
+/**
+ * @brief Does every index in the program refer to a record that exists? The checksum only
+ * catches an image damaged after it was written, and the back ends trust these indices, so an
+ * image that passes it but indexes out of bounds would crash the run rather than be refused.
+ */
+bool indices_valid(const Program &program) noexcept{
+    std::size_t instruction_count = program.instructions.size();
+    auto jump_target = [instruction_count](std::uint32_t target){
+        return target < instruction_count;
+    };
+    // Control cannot run off the end.
+    if(0 == instruction_count || !(ends_block(program.instructions.back().opcode)
+                                   || Opcode::SWITCH == program.instructions.back().opcode)){
+        return false;
+    }
+
+    for(const Instruction &instruction : program.instructions){
+        // Images are written before fusion, so a superinstruction means damage.
+        if(instruction.opcode >= Opcode::TEST_OR_DONE
+           || instruction.operand_count > instruction.operands.size()
+           || instruction.line >= program.lines.size()
+           || (NO_INDEX != instruction.target && !jump_target(instruction.target))
+           || (NO_INDEX != instruction.alternate && !jump_target(instruction.alternate))){
+            return false;
+        }
+        for(unsigned i = 0; i < instruction.operand_count; i++){
+            if(instruction.operands[i] >= program.operands.size()){
+                return false;
+            }
+        }
+        switch(instruction.opcode){
+            case Opcode::SWITCH:
+                // Operands 2 and 3 are the number of cases and the first, not operands.
+                if(!within(instruction.operands[3], instruction.operands[2],
+                           program.cases.size())){
+                    return false;
+                }
+                [[fallthrough]];
+            case Opcode::JUMP:[[fallthrough]];
+            case Opcode::CALL:
+                if(!jump_target(instruction.target)){
+                    return false;
+                }
+                break;
+            case Opcode::DEFINE_FIELD:[[fallthrough]];
+            case Opcode::SAVE_FIELD_DEFINITION:[[fallthrough]];
+            case Opcode::RESTORE_FIELD_DEFINITION:
+                if(instruction.field >= FIELD_COUNT){
+                    return false;
+                }
+                break;
+            case Opcode::GET_CHAIN:
+                if(!chain_fields_valid(program, instruction)){
+                    return false;
+                }
+                break;
+            default:
+                if(is_test(instruction.opcode) && !jump_target(instruction.target)){
+                    return false;
+                }
+                break;
+        }
+    }
+
+    for(const Operand &operand : program.operands){
+        bool has_bug = OperandKind::BUG == operand.kind || OperandKind::FIELD == operand.kind;
+        if(operand.kind > OperandKind::AVAILABLE || (has_bug && operand.bug >= BUG_NAME_COUNT)
+           || (OperandKind::FIELD == operand.kind
+               && (!within(operand.path, operand.length, program.paths.size())
+                   || operand.unchecked > operand.length))){
+            return false;
+        }
+    }
+    for(std::uint8_t field : program.paths){
+        if(field >= FIELD_COUNT){
+            return false;
+        }
+    }
+    for(const LineInfo &line : program.lines){
+        if(!jump_target(line.first)
+           || (NO_INDEX != line.label
+               && !within(line.label, line.label_length, program.strings.size()))){
+            return false;
+        }
+    }
+    for(const SwitchCase &switch_case : program.cases){
+        if(!jump_target(switch_case.target)){
+            return false;
+        }
+    }
+    return true;
+}
+
+ImageStatus read_image(const unsigned char *image, std::size_t bytes, Program &program){
+    ImageHeader header;
+    std::memcpy(&header, image, sizeof(header));
+    if(IMAGE_MAGIC != header.magic){
+        return ImageStatus::NOT_AN_IMAGE;
+    }
+    ImageHeader expected = expected_header();
+    if(header.version != expected.version || header.opcode_count != expected.opcode_count
+       || header.instruction_bytes != expected.instruction_bytes
+       || header.operand_bytes != expected.operand_bytes
+       || header.line_bytes != expected.line_bytes || header.case_bytes != expected.case_bytes
+       || header.byte_order != expected.byte_order){
+        return ImageStatus::WRONG_VERSION;
+    }
+    if(header.bytes != bytes || 0 != bytes % IMAGE_ALIGNMENT
+       || header.checksum != checksum(image + sizeof(header), bytes - sizeof(header))){
+        return ImageStatus::DAMAGED;
+    }
+
+    const ImageSection &strings = header.sections[IMAGE_STRINGS];
+    if(!copy_section(image, bytes, header, IMAGE_INSTRUCTIONS, program.instructions)
+       || !copy_section(image, bytes, header, IMAGE_OPERANDS, program.operands)
+       || !copy_section(image, bytes, header, IMAGE_PATHS, program.paths)
+       || !copy_section(image, bytes, header, IMAGE_LINES, program.lines)
+       || !copy_section(image, bytes, header, IMAGE_CASES, program.cases)
+       || !contains(bytes, strings, 1)){
+        return ImageStatus::DAMAGED;
+    }
+    program.strings.assign(reinterpret_cast<const char *>(image + strings.offset), strings.count);
+    return indices_valid(program) ? ImageStatus::LOADED : ImageStatus::DAMAGED;
+}
+
+} // end anonymous namespace
+
+bool save_image(const Program &program, const std::string &path){
+    ImageHeader header = expected_header();
+    std::string image(sizeof(header), '\0');
+    append_section(image, header, IMAGE_INSTRUCTIONS, program.instructions.data(),
+                   program.instructions.size());
+    append_section(image, header, IMAGE_OPERANDS, program.operands.data(),
+                   program.operands.size());
+    append_section(image, header, IMAGE_PATHS, program.paths.data(), program.paths.size());
+    append_section(image, header, IMAGE_LINES, program.lines.data(), program.lines.size());
+    // Copied member by member so that the padding of each case is zero, and the same program
+    // always makes the same image.
+    std::vector<SwitchCase> cases(program.cases.size());
+    std::memset(static_cast<void *>(cases.data()), 0, cases.size() * sizeof(SwitchCase));
+    for(std::size_t i = 0; i < cases.size(); i++){
+        cases[i].value = program.cases[i].value;
+        cases[i].target = program.cases[i].target;
+    }
+    append_section(image, header, IMAGE_CASES, cases.data(), cases.size());
+    append_section(image, header, IMAGE_STRINGS, program.strings.data(), program.strings.size());
+
+    header.bytes = image.size();
+    header.checksum = checksum(reinterpret_cast<const unsigned char *>(image.data())
+                               + sizeof(header), image.size() - sizeof(header));
+    std::memcpy(&image[0], &header, sizeof(header));
+
+    // Write beside the destination and rename, so that a run starting meanwhile maps either the
+    // old image or the new one, never part of one.
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(image.data(), static_cast<std::streamsize>(image.size()));
+        if(!file){
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    if(0 != std::rename(temporary.c_str(), path.c_str())){
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+ImageStatus load_image(const std::string &path, Program &program){
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0){
+        return ImageStatus::NOT_AN_IMAGE;
+    }
+    struct stat status{};
+    if(0 != fstat(fd, &status) || !S_ISREG(status.st_mode)){
+        ::close(fd);
+        return ImageStatus::NOT_AN_IMAGE;
+    }
+    auto bytes = static_cast<std::size_t>(status.st_size);
+    if(bytes < sizeof(ImageHeader)){
+        // Too short for a header, but an image cut short if it begins as one.
+        std::array<char, IMAGE_MAGIC.size()> magic{};
+        bool truncated = bytes >= magic.size()
+                         && ::read(fd, magic.data(), magic.size())
+                            == static_cast<ssize_t>(magic.size())
+                         && IMAGE_MAGIC == magic;
+        ::close(fd);
+        return truncated ? ImageStatus::DAMAGED : ImageStatus::NOT_AN_IMAGE;
+    }
+    void *mapping = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    ::close(fd);
+    if(MAP_FAILED == mapping){
+        return ImageStatus::NOT_AN_IMAGE;
+    }
+    ImageStatus loaded = read_image(static_cast<const unsigned char *>(mapping), bytes, program);
+    munmap(mapping, bytes);
+    return loaded;
+}
+
+} // end namespace elsix
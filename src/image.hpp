@@ -0,0 +1,114 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+/**
+ * @brief The program image format, `.l6c`, which holds a program ready to run, so that a run
+ * need not read, tokenize, parse, lower, and optimize its source again.
+ *
+ * An image is a header followed by the arrays of a lowered `Program` exactly as they lie
+ * in memory: the instructions, the operands, the field paths, the lines, which are both the label
+ * table and the table of where each line is in the source, the SWITCH cases, and the label text.
+ * Each array starts on an eight byte boundary. The header gives the offset and length of each,
+ * the length of the image, and a checksum of everything after the header.
+ *
+ * Loading maps the file in one `mmap`, checks the header and the checksum, and copies each array
+ * into the program whole. Nothing is parsed or decoded, but every index in the program is checked
+ * once against the array it indexes, since the back ends do not check them. Since the arrays are
+ * the program's own records, an image can only be run by an Elsix with the same records and
+ * instruction set on a machine of the same byte order; the header records enough to refuse any
+ * other.
+ *
+ * An image holds the program as the passes leave it before fusion: `--use-profile` and `--checks`
+ * take effect when it is written.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "program.hpp"
+
+namespace elsix{
+
+constexpr std::uint16_t IMAGE_VERSION = 1;
+constexpr std::array<char, 8> IMAGE_MAGIC{'E', 'L', 'S', 'I', 'X', 'L', '6', 'C'};
+
+enum ImageSectionIndex: unsigned{
+    IMAGE_INSTRUCTIONS,
+    IMAGE_OPERANDS,
+    IMAGE_PATHS,
+    IMAGE_LINES,
+    IMAGE_CASES,
+    IMAGE_STRINGS,
+    IMAGE_SECTION_COUNT
+};
+
+struct ImageSection{
+    // In bytes from the start of the image.
+    std::uint64_t offset;
+    // In records.
+    std::uint64_t count;
+};
+
+struct ImageHeader{
+    std::array<char, 8> magic;
+    std::uint16_t version;
+    std::uint8_t opcode_count;
+    // The size of an instruction, operand, line, and SWITCH case, in bytes, and a marker whose
+    // bytes give the byte order.
+    std::uint8_t instruction_bytes;
+    std::uint8_t operand_bytes;
+    std::uint8_t line_bytes;
+    std::uint8_t case_bytes;
+    std::uint8_t reserved;
+    std::uint32_t byte_order;
+    std::uint32_t reserved2;
+    std::uint64_t bytes;
+    std::uint64_t checksum;
+    std::array<ImageSection, IMAGE_SECTION_COUNT> sections;
+};
+
+static_assert(136 == sizeof(ImageHeader), "The image header must have no padding.");
+
+enum class ImageStatus{
+    LOADED,
+    NOT_AN_IMAGE,   // Including a file that cannot be read.
+    WRONG_VERSION,  // Written by an Elsix with other records or instructions.
+    DAMAGED         // Truncated, the checksum does not match, or an index is out of bounds.
+};
+
+/// Writes `program` as an image to `path`, replacing any file there at once. False on failure.
+bool save_image(const Program &program, const std::string &path);
+
+/// Loads the image at `path` into `program`, unless it is not a loadable image.
+ImageStatus load_image(const std::string &path, Program &program);
+
+} // end namespace elsix
@@ -0,0 +1,547 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "interpreter.hpp"
+#include "conversion.hpp"
+
+namespace elsix{
+
+Interpreter::Interpreter(const Program &program, Runtime &runtime)
+    : program_(program), runtime_(runtime),
+      line_starts_(program.instructions.size(), NO_INDEX),
+      line_budgets_(program.lines.size(), NO_INDEX){
+    for(std::uint32_t line = 0; line < program.lines.size(); line++){
+        if(program.lines[line].first < program.instructions.size()){
+            line_starts_[program.lines[line].first] = line;
+        }
+    }
+    set_jit_enabled(true);
+}
+
+void Interpreter::set_jit_enabled(bool enabled){
+    jit_enabled_ = enabled && Jit::supported();
+    jit_.reset();
+    reset_budgets_();
+}
+
+void Interpreter::set_profile(TestProfile *profile){
+    profile_ = profile;
+    if(nullptr != profile_){
+        set_jit_enabled(false);
+    }
+}
+
+void Interpreter::reset_budgets_(){
+    std::fill(line_budgets_.begin(), line_budgets_.end(),
+              jit_enabled_ ? PROMOTION_BUDGET : NO_INDEX);
+}
+
+int Interpreter::run(){
+    pc_ = 0;
+    try{
+        return execute_();
+    } catch(const RuntimeFault &fault){
+        const LineInfo &line = program_.lines[program_.instructions[pc_].line];
+        throw RuntimeFault(fmt::format("Line {}: {}", line.row + 1, fault.what()));
+    }
+}
+
+// region: Tiers
+
+std::uint32_t Interpreter::enter_(std::uint32_t target, std::uint32_t from){
+    std::uint32_t line = line_starts_[target];
+    while(NO_INDEX != line){
+        bool backward = NO_INDEX != from && line <= from;
+        std::uint32_t cost = backward ? 1 + BACKWARD_JUMP_COST : 1;
+        std::uint32_t &budget = line_budgets_[line];
+        // A line that cannot be compiled keeps NO_INDEX, which counting down would wear away.
+        if(NO_INDEX == budget){
+            return target;
+        }
+        if(budget > cost){
+            budget -= cost;
+            return target;
+        }
+        if(0 != budget && !promote_(line, backward ? from : line)){
+            budget = NO_INDEX;
+            return target;
+        }
+        std::uint32_t next = jit_->entry(target)(runtime_.bugs.data());
+        if(next == target){
+            // The line's first instruction left compiled code before doing anything.
+            return target;
+        }
+        target = next;
+        from = line;
+        line = line_starts_[target];
+    }
+    return target;
+}
+
+bool Interpreter::promote_(std::uint32_t line, std::uint32_t last){
+    if(!jit_enabled_){
+        return false;
+    }
+    if(nullptr == jit_){
+        jit_ = std::make_unique<Jit>(program_, runtime_);
+    }
+    for(std::uint32_t other = line + 1; other <= last; other++){
+        std::uint32_t &budget = line_budgets_[other];
+        // Lines without instructions share their first instruction with the next line.
+        if(0 != budget && NO_INDEX != budget && line_starts_[program_.lines[other].first] == other){
+            budget = (nullptr != jit_->compile(other)) ? 0 : NO_INDEX;
+        }
+    }
+    if(nullptr == jit_->compile(line)){
+        return false;
+    }
+    line_budgets_[line] = 0;
+    return true;
+}
+
+void Interpreter::invalidate_(unsigned field){
+    if(nullptr == jit_){
+        return;
+    }
+    if(FIELD_COUNT == field){
+        jit_->invalidate_all();
+    } else{
+        jit_->invalidate_field(field);
+    }
+    // Demoted lines start over, as do lines that could not be compiled before.
+    for(std::uint32_t line = 0; line < line_budgets_.size(); line++){
+        std::uint32_t first = program_.lines[line].first;
+        bool compiled = first < line_starts_.size() && line == line_starts_[first]
+                        && nullptr != jit_->entry(first);
+        line_budgets_[line] = compiled ? 0 : PROMOTION_BUDGET;
+    }
+}
+
+// endregion: Tiers
+
+// region: Operands
+
+Word Interpreter::load_(const Operand &operand, unsigned i, Word address) const{
+    unsigned field = program_.paths[operand.path + i];
+    return (i < operand.unchecked) ? runtime_.load_unchecked(field, address)
+                                   : runtime_.load(field, address);
+}
+
+Word Interpreter::address_(const Operand &operand) const{
+    Word address = runtime_.bugs[operand.bug];
+    for(unsigned i = 0; i + 1 < operand.length; i++){
+        address = load_(operand, i, address);
+    }
+    return address;
+}
+
+Word Interpreter::value_(const Operand &operand) const{
+    switch(operand.kind){
+        case OperandKind::LITERAL:return operand.value;
+        case OperandKind::BUG:return runtime_.bugs[operand.bug];
+        case OperandKind::FIELD:return load_(operand, operand.length - 1u, address_(operand));
+        case OperandKind::CLOCK:return runtime_.time();
+        case OperandKind::AVAILABLE:return runtime_.available(operand.value);
+        default:return 0;
+    }
+}
+
+void Interpreter::store_(const Operand &operand, Word value){
+    update_(operand, [value](Word){ return value; });
+}
+
+template<typename Operation>
+void Interpreter::update_(const Operand &operand, Operation operation){
+    if(OperandKind::BUG == operand.kind){
+        runtime_.bugs[operand.bug] = operation(runtime_.bugs[operand.bug]);
+    } else if(OperandKind::FIELD == operand.kind){
+        unsigned field = program_.paths[operand.path + operand.length - 1];
+        Word address = address_(operand);
+        if(operand.length <= operand.unchecked){
+            runtime_.store_unchecked(field, address,
+                                     operation(runtime_.load_unchecked(field, address)));
+        } else{
+            runtime_.store(field, address, operation(runtime_.load(field, address)));
+        }
+    } else{
+        Runtime::fault(fmt::format("Cannot store to {}.", program_.operand_name(operand)));
+    }
+}
+
+// endregion: Operands
+
+int Interpreter::execute_(){
+    const Instruction *const instructions = program_.instructions.data();
+    const Instruction *instruction;
+
+    // The handlers, in the order of `Opcode`.
+#define OPERAND(i) (program_.operand(*instruction, (i)))
+#define VALUE(i) (value_(OPERAND(i)))
+#define GOTO(target) do{ pc_ = enter_((target), instruction->line); DISPATCH(); }while(false)
+#define JUMP(target) do{ pc_ = enter_((target), NO_INDEX); DISPATCH(); }while(false)
+#define NEXT() do{ \
+        if(NO_INDEX != line_starts_[++pc_]){ \
+            pc_ = enter_(pc_, NO_INDEX); \
+        } \
+        DISPATCH(); \
+    }while(false)
+// Whether a test jumps, counted in the profile if there is one.
+#define RECORD(jumps) (nullptr == profile_ ? (jumps) : record_((jumps)))
+#define TEST(condition) do{ \
+        Word a = VALUE(0); \
+        Word b = VALUE(1); \
+        if(RECORD((condition) != (0 != (instruction->flags & INVERT)))){ \
+            GOTO(instruction->target); \
+        } \
+        NEXT(); \
+    }while(false)
+// For superinstructions, which count their second instruction when it takes effect.
+#define JUMPS() RECORD(test_holds(static_cast<Opcode>(instruction->field), VALUE(0), VALUE(1)) \
+                        != (0 != (instruction->flags & INVERT)))
+#define SKIP() do{ pc_++; NEXT(); }while(false)
+#define DONE() do{ \
+        if(runtime_.calls.empty()){ \
+            return EXIT_DONE; \
+        } \
+        pc_ = runtime_.calls.back() + 1; \
+        runtime_.calls.pop_back(); \
+        JUMP(pc_); \
+    }while(false)
+#define FAIL() do{ \
+        if(runtime_.calls.empty()){ \
+            return EXIT_FAIL; \
+        } \
+        std::uint32_t site = runtime_.calls.back(); \
+        runtime_.calls.pop_back(); \
+        std::uint32_t alternate = instructions[site].alternate; \
+        JUMP(NO_INDEX == alternate ? site + 1 : alternate); \
+    }while(false)
+#define UPDATE(expression) do{ \
+        update_(OPERAND(0), [&](Word a){ Word b = VALUE(1); return (expression); }); \
+        NEXT(); \
+    }while(false)
+
+#if defined(USE_COMPUTED_GOTO)
+    // Label addresses and computed gotos are the GNU extension this branch is for.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    static const void *const handlers[] = {
+        &&op_TEST_EQUAL, &&op_TEST_NOT_EQUAL, &&op_TEST_GREATER, &&op_TEST_LESS,
+        &&op_TEST_SAME_BLOCK, &&op_TEST_ONE_BITS, &&op_TEST_ZERO_BITS, &&op_JUMP, &&op_SWITCH,
+        &&op_CALL, &&op_RETURN_DONE, &&op_RETURN_FAIL, &&op_HALT, &&op_DUMP, &&op_STATE,
+        &&op_ADVANCE, &&op_SETUP_STORAGE, &&op_DEFINE_FIELD, &&op_GET_BLOCK, &&op_GET_CHAIN,
+        &&op_FREE_BLOCK, &&op_SET_EQUAL, &&op_DUPLICATE_BLOCK, &&op_INTERCHANGE, &&op_POINT,
+        &&op_ADD, &&op_SUBTRACT, &&op_MULTIPLY, &&op_DIVIDE, &&op_OR, &&op_AND, &&op_EXCLUSIVE_OR,
+        &&op_COMPLEMENT, &&op_SHIFT_LEFT, &&op_SHIFT_RIGHT, &&op_LEFT_ONE, &&op_LEFT_ZERO,
+        &&op_RIGHT_ONE, &&op_RIGHT_ZERO, &&op_COUNT_ONES, &&op_COUNT_ZEROES, &&op_INPUT, &&op_PRINT,
+        &&op_PUNCH, &&op_PRINT_LIST, &&op_BINARY_TO_DECIMAL, &&op_DECIMAL_TO_BINARY,
+        &&op_BINARY_TO_OCTAL, &&op_OCTAL_TO_BINARY, &&op_BLANKS_TO_ZEROES, &&op_ZEROES_TO_BLANKS,
+        &&op_X_RANGE, &&op_Y_RANGE, &&op_DRAW, &&op_TYPE_HORIZONTALLY, &&op_TYPE_VERTICALLY,
+        &&op_SAVE_FIELD_CONTENTS, &&op_RESTORE_FIELD_CONTENTS, &&op_SAVE_FIELD_DEFINITION,
+        &&op_RESTORE_FIELD_DEFINITION, &&op_TEST_OR_DONE, &&op_TEST_OR_FAIL,
+        &&op_TEST_OR_INTERCHANGE, &&op_FOLLOW_LINK, &&op_GET_BLOCK_AND_LINK
+    };
+    static_assert(sizeof(handlers) / sizeof(handlers[0])
+                  == static_cast<std::size_t>(Opcode::OPCODE_COUNT),
+                  "Every opcode needs a handler.");
+#define HANDLER(opcode) op_##opcode:
+#define DISPATCH() do{ \
+        instruction = &instructions[pc_]; \
+        runtime_.clock.count_operation(); \
+        goto *handlers[static_cast<unsigned>(instruction->opcode)]; \
+    }while(false)
+
+    DISPATCH();
+    {
+#else
+#define HANDLER(opcode) case Opcode::opcode:
+#define DISPATCH() goto dispatch
+
+dispatch:
+    instruction = &instructions[pc_];
+    runtime_.clock.count_operation();
+    switch(instruction->opcode){
+#endif
+
+        // region: Control
+
+        HANDLER(TEST_EQUAL) TEST(a == b);
+        HANDLER(TEST_NOT_EQUAL) TEST(a != b);
+        HANDLER(TEST_GREATER) TEST(a > b);
+        HANDLER(TEST_LESS) TEST(a < b);
+        HANDLER(TEST_SAME_BLOCK) TEST(a == b);
+        HANDLER(TEST_ONE_BITS) TEST(0 == (b & ~a));
+        HANDLER(TEST_ZERO_BITS) TEST(0 == (a & ~b));
+        HANDLER(JUMP) GOTO(instruction->target);
+        HANDLER(SWITCH){
+            Word value = VALUE(0);
+            const SwitchCase *first = &program_.cases[instruction->operands[3]];
+            const SwitchCase *last = first + instruction->operands[2];
+            const SwitchCase *found = std::lower_bound(
+                first, last, value, [](const SwitchCase &c, Word v){ return c.value < v; });
+            GOTO((last != found && found->value == value) ? found->target
+                                                          : instruction->alternate);
+        }
+        HANDLER(CALL)
+            runtime_.calls.push_back(pc_);
+            JUMP(instruction->target);
+        HANDLER(RETURN_DONE) DONE();
+        HANDLER(RETURN_FAIL) FAIL();
+        HANDLER(HALT) return EXIT_DONE;
+        HANDLER(DUMP)
+            runtime_.dump();
+            NEXT();
+        HANDLER(STATE)
+            runtime_.state();
+            NEXT();
+        HANDLER(ADVANCE)
+            runtime_.advance();
+            NEXT();
+
+        // endregion: Control
+
+        // region: Storage
+
+        HANDLER(SETUP_STORAGE)
+            runtime_.setup_storage(VALUE(0), VALUE(1), VALUE(2));
+            invalidate_(FIELD_COUNT);
+            NEXT();
+        HANDLER(DEFINE_FIELD)
+            runtime_.define_field(instruction->field, VALUE(0), VALUE(1), VALUE(2));
+            invalidate_(instruction->field);
+            NEXT();
+        HANDLER(GET_BLOCK){
+            Word old = VALUE(0);
+            Word block = runtime_.get_block(OPERAND(0).bug, VALUE(1));
+            store_(OPERAND(0), block);
+            if(3 == instruction->operand_count){
+                store_(OPERAND(2), old);
+            }
+            NEXT();
+        }
+        HANDLER(GET_CHAIN)
+            store_(OPERAND(0), runtime_.get_chain(OPERAND(0).bug, VALUE(1), VALUE(2), VALUE(3)));
+            NEXT();
+        HANDLER(FREE_BLOCK){
+            Word replacement = VALUE(1);
+            runtime_.free_block(VALUE(0));
+            store_(OPERAND(0), replacement);
+            NEXT();
+        }
+        HANDLER(SET_EQUAL) UPDATE((static_cast<void>(a), b));
+        HANDLER(DUPLICATE_BLOCK)
+            store_(OPERAND(0), runtime_.duplicate_block(VALUE(1)));
+            NEXT();
+        HANDLER(INTERCHANGE){
+            Word first = VALUE(0);
+            Word second = VALUE(1);
+            store_(OPERAND(0), second);
+            store_(OPERAND(1), first);
+            NEXT();
+        }
+        HANDLER(POINT) UPDATE((static_cast<void>(a), b));
+
+        // endregion: Storage
+
+        // region: Arithmetic and logic
+
+        HANDLER(ADD) UPDATE(a + b);
+        HANDLER(SUBTRACT) UPDATE(a - b);
+        HANDLER(MULTIPLY) UPDATE(a * b);
+        HANDLER(DIVIDE) UPDATE(Runtime::divide(a, b));
+        HANDLER(OR) UPDATE(a | b);
+        HANDLER(AND) UPDATE(a & b);
+        HANDLER(EXCLUSIVE_OR) UPDATE(a ^ b);
+        HANDLER(COMPLEMENT) UPDATE((static_cast<void>(a), ~b));
+        HANDLER(SHIFT_LEFT)
+            if(3 == instruction->operand_count){
+                UPDATE(shift_left_filling(a, b, VALUE(2)));
+            }
+            UPDATE(shift_left(a, b));
+        HANDLER(SHIFT_RIGHT)
+            if(3 == instruction->operand_count){
+                UPDATE(shift_right_filling(a, b, VALUE(2)));
+            }
+            UPDATE(shift_right(a, b));
+        HANDLER(LEFT_ONE) UPDATE((static_cast<void>(a), left_one(b)));
+        HANDLER(LEFT_ZERO) UPDATE((static_cast<void>(a), left_zero(b)));
+        HANDLER(RIGHT_ONE) UPDATE((static_cast<void>(a), right_one(b)));
+        HANDLER(RIGHT_ZERO) UPDATE((static_cast<void>(a), right_zero(b)));
+        HANDLER(COUNT_ONES) UPDATE((static_cast<void>(a), count_ones(b)));
+        HANDLER(COUNT_ZEROES) UPDATE((static_cast<void>(a), count_zeroes(b)));
+
+        // endregion: Arithmetic and logic
+
+        // region: Input, output, and conversion
+
+        HANDLER(INPUT)
+            store_(OPERAND(0), runtime_.input(VALUE(1)));
+            NEXT();
+        HANDLER(PRINT)
+            runtime_.print(VALUE(0), VALUE(1));
+            NEXT();
+        HANDLER(PUNCH)
+            runtime_.punch(VALUE(0), VALUE(1));
+            NEXT();
+        HANDLER(PRINT_LIST)
+            runtime_.print_list(VALUE(0), static_cast<unsigned>(VALUE(1)),
+                                3 == instruction->operand_count ? VALUE(2) : 0);
+            NEXT();
+        HANDLER(BINARY_TO_DECIMAL) UPDATE((static_cast<void>(a), binary_to_decimal(b)));
+        HANDLER(DECIMAL_TO_BINARY) UPDATE((static_cast<void>(a), decimal_to_binary(b)));
+        HANDLER(BINARY_TO_OCTAL) UPDATE((static_cast<void>(a), binary_to_octal(b)));
+        HANDLER(OCTAL_TO_BINARY) UPDATE((static_cast<void>(a), octal_to_binary(b)));
+        HANDLER(BLANKS_TO_ZEROES) UPDATE((static_cast<void>(a), blanks_to_zeroes(b)));
+        HANDLER(ZEROES_TO_BLANKS) UPDATE((static_cast<void>(a), zeroes_to_blanks(b)));
+        HANDLER(X_RANGE)
+            runtime_.x_range(VALUE(0), VALUE(1));
+            NEXT();
+        HANDLER(Y_RANGE)
+            runtime_.y_range(VALUE(0), VALUE(1));
+            NEXT();
+        HANDLER(DRAW)
+            if(4 == instruction->operand_count){
+                runtime_.draw(VALUE(0), VALUE(1), VALUE(2), VALUE(3));
+            } else{
+                runtime_.draw(VALUE(0), VALUE(1));
+            }
+            NEXT();
+        HANDLER(TYPE_HORIZONTALLY)
+            runtime_.type(VALUE(0), VALUE(1), VALUE(2), VALUE(3), false);
+            NEXT();
+        HANDLER(TYPE_VERTICALLY)
+            runtime_.type(VALUE(0), VALUE(1), VALUE(2), VALUE(3), true);
+            NEXT();
+
+        // endregion: Input, output, and conversion
+
+        // region: Stacks
+
+        HANDLER(SAVE_FIELD_CONTENTS)
+            runtime_.save_contents(VALUE(0));
+            NEXT();
+        HANDLER(RESTORE_FIELD_CONTENTS)
+            store_(OPERAND(0), runtime_.restore_contents());
+            NEXT();
+        HANDLER(SAVE_FIELD_DEFINITION)
+            runtime_.save_definition(instruction->field);
+            NEXT();
+        HANDLER(RESTORE_FIELD_DEFINITION)
+            runtime_.restore_definition(instruction->field);
+            invalidate_(instruction->field);
+            NEXT();
+
+        // endregion: Stacks
+
+        // region: Superinstructions
+
+        HANDLER(TEST_OR_DONE)
+            if(JUMPS()){
+                GOTO(instruction->target);
+            }
+            runtime_.clock.count_operation();
+            DONE();
+        HANDLER(TEST_OR_FAIL)
+            if(JUMPS()){
+                GOTO(instruction->target);
+            }
+            runtime_.clock.count_operation();
+            FAIL();
+        HANDLER(TEST_OR_INTERCHANGE){
+            Word a = VALUE(0);
+            Word b = VALUE(1);
+            if(RECORD(test_holds(static_cast<Opcode>(instruction->field), a, b)
+                      != (0 != (instruction->flags & INVERT)))){
+                GOTO(instruction->target);
+            }
+            runtime_.clock.count_operation();
+            store_(OPERAND(0), b);
+            store_(OPERAND(1), a);
+            SKIP();
+        }
+        HANDLER(FOLLOW_LINK){
+            Word &bug = runtime_.bugs[OPERAND(0).bug];
+            bug = runtime_.load(instruction->field, bug);
+            NEXT();
+        }
+        HANDLER(GET_BLOCK_AND_LINK){
+            Word old = VALUE(0);
+            Word block = runtime_.get_block(OPERAND(0).bug, VALUE(1));
+            store_(OPERAND(0), block);
+            if(3 == instruction->operand_count){
+                store_(OPERAND(2), old);
+            }
+            runtime_.clock.count_operation();
+            store_(OPERAND(3), block);
+            SKIP();
+        }
+
+        // endregion: Superinstructions
+
+#if !defined(USE_COMPUTED_GOTO)
+        case Opcode::OPCODE_COUNT:break;
+#endif
+    }
+    return EXIT_DONE;
+
+#undef OPERAND
+#undef VALUE
+#undef GOTO
+#undef JUMP
+#undef NEXT
+#undef RECORD
+#undef TEST
+#undef JUMPS
+#undef SKIP
+#undef DONE
+#undef FAIL
+#undef UPDATE
+#undef HANDLER
+#undef DISPATCH
+}
+#if defined(USE_COMPUTED_GOTO)
+#pragma GCC diagnostic pop
+#endif
+
+int interpret(const Program &program, const RuntimeOptions &options, bool jit,
+              TestProfile *profile){
+    return run_protected(options, [&](Runtime &runtime){
+        Interpreter interpreter(program, runtime);
+        interpreter.set_jit_enabled(jit);
+        interpreter.set_profile(profile);
+        return interpreter.run();
+    });
+}
+
+} // end namespace elsix
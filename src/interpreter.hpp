@@ -0,0 +1,139 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The interpreter, which executes a lowered program in two tiers.
+ *
+ * Every line starts in the baseline tier, which interprets the lowered instructions directly and
+ * needs no preparation, so a short deck starts at once. Dispatch is by computed goto where the
+ * compiler supports it (`USE_COMPUTED_GOTO`), so that each handler ends in its own indirect jump,
+ * and by a `switch` otherwise.
+ *
+ * Each line has a budget that entering the line, by a jump or by falling into it, counts down. A
+ * GOTO back to the line or to an earlier one costs more, since it closes a loop. A line whose
+ * budget runs out is promoted to the optimizing tier: the JIT compiles it with field accessors
+ * specialized on the current field definitions, and a line promoted by a backward GOTO brings
+ * the rest of its loop along. From then on entering the line runs its machine code, and compiled
+ * lines that continue into one another run one after the other without returning to dispatch.
+ * Redefining a field demotes the lines that depended on it, and they start counting again.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "program.hpp"
+#include "runtime.hpp"
+#include "jit.hpp"
+#include "conditions.hpp"
+
+namespace elsix{
+
+class Interpreter{
+public:
+    /// The budget of a line in the baseline tier. Each entry to the line costs one.
+    static constexpr std::uint32_t PROMOTION_BUDGET = 256;
+    /// What a GOTO back to a line costs in addition.
+    static constexpr std::uint32_t BACKWARD_JUMP_COST = 8;
+
+    Interpreter(const Program &program, Runtime &runtime);
+
+    /// Enables or disables the optimizing tier. Enabled by default where the JIT is supported.
+    void set_jit_enabled(bool enabled);
+
+    /**
+     * @brief Records how each test runs in `profile`, or nothing if it is null. Compiled lines
+     * do not record, so this disables the optimizing tier.
+     */
+    void set_profile(TestProfile *profile);
+
+    /**
+     * @brief Runs the program from its first line.
+     * @return `EXIT_DONE` or `EXIT_FAIL`. A fault propagates as a `RuntimeFault` naming the line.
+     */
+    int run();
+
+    /// The JIT, or null if no line has been promoted.
+    [[nodiscard]] const Jit *jit() const noexcept{
+        return jit_.get();
+    }
+
+private:
+    const Program &program_;
+    Runtime &runtime_;
+    bool jit_enabled_ = false;
+    // Created when the first line is promoted.
+    std::unique_ptr<Jit> jit_;
+    // Indexed by instruction: the line an instruction begins, or NO_INDEX.
+    std::vector<std::uint32_t> line_starts_;
+    // Indexed by line: the budget left in the baseline tier, 0 for a line in the optimizing
+    // tier, or NO_INDEX for a line that cannot be compiled.
+    std::vector<std::uint32_t> line_budgets_;
+    // The instruction being executed.
+    std::uint32_t pc_ = 0;
+    TestProfile *profile_ = nullptr;
+
+    int execute_();
+    /**
+     * @brief Enters the line beginning at `target`, if any, from line `from`, or from NO_INDEX
+     * if not by GOTO. Runs compiled code where there is any.
+     * @return Where to continue interpreting.
+     */
+    std::uint32_t enter_(std::uint32_t target, std::uint32_t from);
+    /// Compiles `line` and, if it is the head of a loop closed in line `last`, the loop's body.
+    bool promote_(std::uint32_t line, std::uint32_t last);
+    /// Demotes lines that depend on `field`, or on every field if it is FIELD_COUNT.
+    void invalidate_(unsigned field);
+    void reset_budgets_();
+    bool record_(bool jumps){
+        profile_->record(pc_, jumps);
+        return jumps;
+    }
+
+    /// Access `i` of the path of a field operand, at `address`.
+    [[nodiscard]] Word load_(const Operand &operand, unsigned i, Word address) const;
+    [[nodiscard]] Word value_(const Operand &operand) const;
+    /// The block holding the field `operand` names.
+    [[nodiscard]] Word address_(const Operand &operand) const;
+    void store_(const Operand &operand, Word value);
+    template<typename Operation>
+    void update_(const Operand &operand, Operation operation);
+};
+
+/**
+ * @brief Runs a program with the interpreter, and reports a fault.
+ * @return `EXIT_DONE`, `EXIT_FAIL`, or `EXIT_FAULT`.
+ */
+int interpret(const Program &program, const RuntimeOptions &options, bool jit = true,
+              TestProfile *profile = nullptr);
+
+} // end namespace elsix
@@ -0,0 +1,590 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "jit.hpp"
+#include "fusion.hpp"
+#include "runtime.hpp"
+#include "x86emitter.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// Registers holding bugs, all callee-saved.
+constexpr std::array<Reg, Jit::PINNED_BUGS> BUG_REGISTERS{
+    Reg::RBX, Reg::R12, Reg::R13, Reg::R14, Reg::R15
+};
+
+// Fixed register roles. RDI holds the bugs throughout and R11 the operation counter. Scratch:
+// RAX and RCX hold operand values, RDX addresses, R8 the word offset of a checked address, R9
+// the host address of the region's words, RSI and R10 temporaries.
+constexpr Reg BUGS = Reg::RDI;
+constexpr Reg OPERATIONS = Reg::R11;
+
+/// Emits the code of one line.
+class LineCompiler{
+public:
+    LineCompiler(const Program &program, Runtime &runtime, std::uint32_t line)
+        : program_(program), runtime_(runtime),
+          access_(runtime.storage.region(0).direct_access()),
+          first_(program.lines[line].first),
+          end_(line + 1 < program.lines.size() ? program.lines[line + 1].first
+                                               : static_cast<std::uint32_t>(
+                                                   program.instructions.size())){
+        pinned_.fill(BUG_NAME_COUNT);
+    }
+
+    /// Returns false if not even the first instruction can be compiled.
+    bool compile(){
+        if(!compilable_(unfused(program_.instructions[first_]))){
+            return false;
+        }
+        choose_pinned_();
+        prologue_();
+        loop_head_ = emitter_.position();
+        std::uint32_t index = first_;
+        for(; index < end_; index++){
+            // A superinstruction is compiled as its parts.
+            Instruction instruction = unfused(program_.instructions[index]);
+            if(!compilable_(instruction)){
+                break;
+            }
+            emit_(index, instruction);
+            if(ends_block(instruction.opcode)){
+                break;
+            }
+        }
+        if(index == end_ || !ends_block(program_.instructions[index].opcode)){
+            exit_to_(emitter_.jump(), index);
+        }
+        exits_and_epilogue_();
+        return true;
+    }
+
+    [[nodiscard]] const std::vector<std::uint8_t> &code() const noexcept{
+        return emitter_.code();
+    }
+
+    [[nodiscard]] const std::vector<std::pair<unsigned, FieldDefinition>> &fields() const noexcept{
+        return fields_;
+    }
+
+private:
+    const Program &program_;
+    Runtime &runtime_;
+    StorageRegion::DirectAccess access_;
+    std::uint32_t first_;
+    std::uint32_t end_;
+    X86Emitter emitter_;
+    std::size_t loop_head_ = 0;
+    // The bug in each of BUG_REGISTERS, or BUG_NAME_COUNT for none.
+    std::array<unsigned, Jit::PINNED_BUGS> pinned_{};
+    // Operations executed on the current path and not yet added to the operation count.
+    std::uint32_t pending_ = 0;
+    // Jumps out of compiled code, each with the instruction to continue at and the operations
+    // still to count.
+    struct Exit{
+        X86Emitter::Patch patch;
+        std::uint32_t continuation;
+        std::uint32_t pending;
+    };
+    std::vector<Exit> exits_;
+    std::vector<std::pair<unsigned, FieldDefinition>> fields_;
+
+    // region: Choosing what to compile
+
+    [[nodiscard]] bool compilable_(const Operand &operand) const{
+        switch(operand.kind){
+            case OperandKind::LITERAL:[[fallthrough]];
+            case OperandKind::BUG:return true;
+            case OperandKind::FIELD:
+                for(unsigned i = 0; i < operand.length; i++){
+                    unsigned field = program_.paths[operand.path + i];
+                    if(!runtime_.defined(field)
+                       || FieldLayout::STRADDLING == runtime_.field(field).layout){
+                        return false;
+                    }
+                }
+                return true;
+            default:return false;
+        }
+    }
+
+    [[nodiscard]] bool compilable_(const Instruction &instruction) const{
+        switch(instruction.opcode){
+            case Opcode::JUMP:return true;
+            case Opcode::SET_EQUAL:
+            case Opcode::POINT:
+            case Opcode::ADD:
+            case Opcode::SUBTRACT:
+            case Opcode::MULTIPLY:
+            case Opcode::OR:
+            case Opcode::AND:
+            case Opcode::EXCLUSIVE_OR:
+            case Opcode::COMPLEMENT:{
+                const Operand &destination = program_.operand(instruction, 0);
+                return 2 == instruction.operand_count
+                       && (OperandKind::BUG == destination.kind
+                           || OperandKind::FIELD == destination.kind)
+                       && compilable_(destination)
+                       && compilable_(program_.operand(instruction, 1));
+            }
+            default:
+                return is_test(instruction.opcode)
+                       && compilable_(program_.operand(instruction, 0))
+                       && compilable_(program_.operand(instruction, 1));
+        }
+    }
+
+    /// Pins the bugs the line uses most.
+    void choose_pinned_(){
+        std::array<unsigned, BUG_NAME_COUNT> uses{};
+        for(std::uint32_t index = first_; index < end_; index++){
+            const Instruction &instruction = program_.instructions[index];
+            for(unsigned i = 0; i < instruction.operand_count; i++){
+                const Operand &operand = program_.operand(instruction, i);
+                if(OperandKind::BUG == operand.kind || OperandKind::FIELD == operand.kind){
+                    uses[operand.bug]++;
+                }
+            }
+        }
+        for(unsigned &pinned : pinned_){
+            auto most = std::max_element(uses.begin(), uses.end());
+            if(0 == *most){
+                break;
+            }
+            pinned = static_cast<unsigned>(most - uses.begin());
+            *most = 0;
+        }
+    }
+
+    /// The register bug `bug` is pinned to, or RSP if it is in memory.
+    [[nodiscard]] Reg register_of_(unsigned bug) const noexcept{
+        for(unsigned i = 0; i < Jit::PINNED_BUGS; i++){
+            if(pinned_[i] == bug){
+                return BUG_REGISTERS[i];
+            }
+        }
+        return Reg::RSP;
+    }
+
+    // endregion: Choosing what to compile
+
+    // region: Entry and exit
+
+    void prologue_(){
+        for(Reg reg : BUG_REGISTERS){
+            emitter_.push(reg);
+        }
+        emitter_.mov(OPERATIONS, reinterpret_cast<std::uint64_t>(
+            runtime_.clock.operations_address()));
+        for(unsigned i = 0; i < Jit::PINNED_BUGS; i++){
+            if(pinned_[i] < BUG_NAME_COUNT){
+                emitter_.load(BUG_REGISTERS[i], BUGS, static_cast<std::int32_t>(8 * pinned_[i]));
+            }
+        }
+    }
+
+    void exit_to_(X86Emitter::Patch patch, std::uint32_t instruction){
+        exits_.push_back({patch, instruction, pending_});
+    }
+
+    /// Adds the pending operations to the operation count. Changes the flags.
+    void count_pending_(){
+        if(0 != pending_){
+            emitter_.add_to(OPERATIONS, pending_);
+            pending_ = 0;
+        }
+    }
+
+    /**
+     * @brief A jump to `target`, which stays in compiled code if it is the start of the line. A
+     * jump back must be preceded by `count_pending_()`.
+     */
+    void jump_to_(X86Emitter::Patch patch, std::uint32_t target){
+        if(target == first_){
+            emitter_.patch(patch, loop_head_);
+        } else{
+            exit_to_(patch, target);
+        }
+    }
+
+    /**
+     * @brief Emits one stub per distinct continuation and operation count, which counts the
+     * operations and sets the continuation as the result, then the epilogue.
+     */
+    void exits_and_epilogue_(){
+        std::sort(exits_.begin(), exits_.end(), [](const Exit &a, const Exit &b){
+            return a.continuation < b.continuation
+                   || (a.continuation == b.continuation && a.pending < b.pending);
+        });
+        std::vector<X86Emitter::Patch> to_epilogue;
+        for(std::size_t i = 0; i < exits_.size();){
+            std::size_t stub = emitter_.position();
+            std::uint32_t continuation = exits_[i].continuation;
+            std::uint32_t pending = exits_[i].pending;
+            if(0 != pending){
+                emitter_.add_to(OPERATIONS, pending);
+            }
+            emitter_.mov(Reg::RAX, continuation);
+            for(; i < exits_.size() && exits_[i].continuation == continuation
+                  && exits_[i].pending == pending; i++){
+                emitter_.patch(exits_[i].patch, stub);
+            }
+            if(i < exits_.size()){
+                to_epilogue.push_back(emitter_.jump());
+            }
+        }
+        for(X86Emitter::Patch patch : to_epilogue){
+            emitter_.patch(patch, emitter_.position());
+        }
+        for(unsigned i = 0; i < Jit::PINNED_BUGS; i++){
+            if(pinned_[i] < BUG_NAME_COUNT){
+                emitter_.store(BUGS, static_cast<std::int32_t>(8 * pinned_[i]), BUG_REGISTERS[i]);
+            }
+        }
+        for(auto reg = BUG_REGISTERS.rbegin(); reg != BUG_REGISTERS.rend(); ++reg){
+            emitter_.pop(*reg);
+        }
+        emitter_.ret();
+    }
+
+    // endregion: Entry and exit
+
+    // region: Operands
+
+    void use_field_(unsigned field){
+        for(const auto &used : fields_){
+            if(used.first == field){
+                return;
+            }
+        }
+        fields_.emplace_back(field, runtime_.field(field));
+    }
+
+    /**
+     * @brief Checks that the address in `address` is in the region's buddy storage, free of
+     * `barrier`, and reaches field `field`, leaving its word offset in R8 and the host address of
+     * the region's words in R9. Otherwise leaves compiled code for instruction `index`.
+     */
+    void check_(Reg address, std::uint8_t barrier, unsigned field, std::uint32_t index){
+        emitter_.test(address, address);
+        exit_to_(emitter_.jump(Condition::EQUAL), index);
+        emitter_.mov(Reg::R8, address);
+        if(0 != access_.first_word){
+            emitter_.mov(Reg::RSI, access_.first_word);
+            emitter_.sub(Reg::R8, Reg::RSI);
+        }
+        emitter_.mov(Reg::RSI, access_.size);
+        emitter_.cmp(Reg::R8, Reg::RSI);
+        exit_to_(emitter_.jump(Condition::ABOVE_OR_EQUAL), index);
+        emitter_.mov(Reg::RSI, reinterpret_cast<std::uint64_t>(access_.tags));
+        emitter_.test_byte(Reg::RSI, Reg::R8, barrier);
+        exit_to_(emitter_.jump(Condition::NOT_EQUAL), index);
+        // Any address reaches word 0. Beyond it, the block there must be of an order whose size
+        // exceeds the word, and an address that is not that of a block is left to the runtime.
+        Word word = runtime_.field(field).word;
+        if(0 != word){
+            auto order = static_cast<std::int32_t>(WORD_BITS - __builtin_clzll(word));
+            emitter_.load_byte(Reg::RSI, Reg::RSI, Reg::R8);
+            emitter_.and_(Reg::RSI, access_.allocated | access_.order_mask);
+            emitter_.cmp(Reg::RSI, access_.allocated | order);
+            exit_to_(emitter_.jump(Condition::BELOW), index);
+        }
+        emitter_.mov(Reg::R9, reinterpret_cast<std::uint64_t>(access_.words));
+    }
+
+    void mask_(Reg value, const FieldDefinition &definition){
+        if(~Word{0} == definition.mask){
+            return;
+        }
+        if(definition.mask <= 0x7fffffff){
+            emitter_.and_(value, static_cast<std::int32_t>(definition.mask));
+        } else{
+            emitter_.mov(Reg::RSI, definition.mask);
+            emitter_.and_(value, Reg::RSI);
+        }
+    }
+
+    /// `value` = field `field` of the checked block at R8 and R9.
+    void extract_(Reg value, unsigned field){
+        const FieldDefinition &definition = runtime_.field(field);
+        emitter_.load_indexed(value, Reg::R9, Reg::R8,
+                              static_cast<std::int32_t>(8 * definition.word));
+        if(0 != definition.shift){
+            emitter_.shr(value, definition.shift);
+        }
+        mask_(value, definition);
+    }
+
+    /// Field `field` of the checked block at R8 and R9 = RAX. Clobbers RDX, RSI, and R10.
+    void insert_(unsigned field){
+        const FieldDefinition &definition = runtime_.field(field);
+        auto displacement = static_cast<std::int32_t>(8 * definition.word);
+        if(~Word{0} == definition.mask){
+            emitter_.store_indexed(Reg::R9, Reg::R8, displacement, Reg::RAX);
+            return;
+        }
+        emitter_.load_indexed(Reg::RDX, Reg::R9, Reg::R8, displacement);
+        emitter_.mov(Reg::RSI, ~(definition.mask << definition.shift));
+        emitter_.and_(Reg::RDX, Reg::RSI);
+        emitter_.mov(Reg::R10, Reg::RAX);
+        mask_(Reg::R10, definition);
+        if(0 != definition.shift){
+            emitter_.shl(Reg::R10, definition.shift);
+        }
+        emitter_.or_(Reg::RDX, Reg::R10);
+        emitter_.store_indexed(Reg::R9, Reg::R8, displacement, Reg::RDX);
+    }
+
+    void load_bug_(Reg destination, unsigned bug){
+        Reg reg = register_of_(bug);
+        if(Reg::RSP == reg){
+            emitter_.load(destination, BUGS, static_cast<std::int32_t>(8 * bug));
+        } else{
+            emitter_.mov(destination, reg);
+        }
+    }
+
+    void store_bug_(unsigned bug, Reg source){
+        Reg reg = register_of_(bug);
+        if(Reg::RSP == reg){
+            emitter_.store(BUGS, static_cast<std::int32_t>(8 * bug), source);
+        } else{
+            emitter_.mov(reg, source);
+        }
+    }
+
+    /// `destination` = the block holding the field `operand` names. Clobbers R8, R9, and RSI.
+    void address_(Reg destination, const Operand &operand, std::uint32_t index){
+        load_bug_(destination, operand.bug);
+        for(unsigned i = 0; i + 1 < operand.length; i++){
+            unsigned field = program_.paths[operand.path + i];
+            use_field_(field);
+            check_(destination, access_.read_barrier, field, index);
+            extract_(destination, field);
+        }
+    }
+
+    /// `destination` = the value of `operand`. Clobbers R8, R9, and RSI.
+    void value_(Reg destination, const Operand &operand, std::uint32_t index){
+        switch(operand.kind){
+            case OperandKind::LITERAL:emitter_.mov(destination, operand.value);
+                break;
+            case OperandKind::BUG:load_bug_(destination, operand.bug);
+                break;
+            default:{
+                unsigned field = program_.paths[operand.path + operand.length - 1];
+                use_field_(field);
+                address_(destination, operand, index);
+                check_(destination, access_.read_barrier, field, index);
+                extract_(destination, field);
+                break;
+            }
+        }
+    }
+
+    // endregion: Operands
+
+    void emit_(std::uint32_t index, const Instruction &instruction){
+        if(Opcode::JUMP == instruction.opcode){
+            pending_++;
+            if(instruction.target == first_){
+                count_pending_();
+            }
+            jump_to_(emitter_.jump(), instruction.target);
+            return;
+        }
+        if(is_test(instruction.opcode)){
+            emit_test_(index, instruction);
+            return;
+        }
+
+        // Everything that can leave compiled code comes before anything with an effect.
+        const Operand &destination = program_.operand(instruction, 0);
+        value_(Reg::RCX, program_.operand(instruction, 1), index);
+        unsigned field = 0;
+        if(OperandKind::FIELD == destination.kind){
+            field = program_.paths[destination.path + destination.length - 1];
+            address_(Reg::RDX, destination, index);
+            check_(Reg::RDX, access_.write_barrier, field, index);
+        }
+        pending_++;
+
+        bool uses_old = Opcode::SET_EQUAL != instruction.opcode
+                        && Opcode::POINT != instruction.opcode
+                        && Opcode::COMPLEMENT != instruction.opcode;
+        if(uses_old){
+            if(OperandKind::FIELD == destination.kind){
+                extract_(Reg::RAX, field);
+            } else{
+                load_bug_(Reg::RAX, destination.bug);
+            }
+        }
+        switch(instruction.opcode){
+            case Opcode::ADD:emitter_.add(Reg::RAX, Reg::RCX);
+                break;
+            case Opcode::SUBTRACT:emitter_.sub(Reg::RAX, Reg::RCX);
+                break;
+            case Opcode::MULTIPLY:emitter_.imul(Reg::RAX, Reg::RCX);
+                break;
+            case Opcode::OR:emitter_.or_(Reg::RAX, Reg::RCX);
+                break;
+            case Opcode::AND:emitter_.and_(Reg::RAX, Reg::RCX);
+                break;
+            case Opcode::EXCLUSIVE_OR:emitter_.xor_(Reg::RAX, Reg::RCX);
+                break;
+            case Opcode::COMPLEMENT:emitter_.mov(Reg::RAX, Reg::RCX);
+                emitter_.not_(Reg::RAX);
+                break;
+            default:emitter_.mov(Reg::RAX, Reg::RCX);
+                break;
+        }
+        if(OperandKind::FIELD == destination.kind){
+            insert_(field);
+        } else{
+            store_bug_(destination.bug, Reg::RAX);
+        }
+    }
+
+    void emit_test_(std::uint32_t index, const Instruction &instruction){
+        value_(Reg::RAX, program_.operand(instruction, 0), index);
+        value_(Reg::RCX, program_.operand(instruction, 1), index);
+        pending_++;
+        if(instruction.target == first_){
+            // Both ways on from the test have executed the same operations.
+            count_pending_();
+        }
+        Condition holds = Condition::EQUAL;
+        switch(instruction.opcode){
+            case Opcode::TEST_ONE_BITS:
+                // (b & ~a) == 0
+                emitter_.mov(Reg::RDX, Reg::RAX);
+                emitter_.not_(Reg::RDX);
+                emitter_.and_(Reg::RDX, Reg::RCX);
+                break;
+            case Opcode::TEST_ZERO_BITS:
+                // (a & ~b) == 0
+                emitter_.mov(Reg::RDX, Reg::RCX);
+                emitter_.not_(Reg::RDX);
+                emitter_.and_(Reg::RDX, Reg::RAX);
+                break;
+            default:
+                emitter_.cmp(Reg::RAX, Reg::RCX);
+                holds = (Opcode::TEST_NOT_EQUAL == instruction.opcode) ? Condition::NOT_EQUAL
+                        : (Opcode::TEST_GREATER == instruction.opcode) ? Condition::ABOVE
+                        : (Opcode::TEST_LESS == instruction.opcode) ? Condition::BELOW
+                        : Condition::EQUAL;
+                break;
+        }
+        if(0 != (instruction.flags & INVERT)){
+            holds = negate(holds);
+        }
+        jump_to_(emitter_.jump(holds), instruction.target);
+    }
+};
+
+} // end anonymous namespace
+
+Jit::Jit(const Program &program, Runtime &runtime)
+    : program_(program), runtime_(runtime), entries_(program.instructions.size(), nullptr){
+}
+
+Jit::~Jit(){
+    invalidate_all();
+}
+
+JitFunction Jit::compile(std::uint32_t line){
+    if(!supported() || 1 != runtime_.storage.region_count()){
+        return nullptr;
+    }
+    LineCompiler compiler(program_, runtime_, line);
+    if(!compiler.compile()){
+        return nullptr;
+    }
+
+    const std::vector<std::uint8_t> &code = compiler.code();
+    auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::size_t bytes = (code.size() + page - 1) / page * page;
+    void *memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                        0);
+    if(MAP_FAILED == memory){
+        return nullptr;
+    }
+    std::memcpy(memory, code.data(), code.size());
+    if(0 != mprotect(memory, bytes, PROT_READ | PROT_EXEC)){
+        munmap(memory, bytes);
+        return nullptr;
+    }
+
+    std::uint32_t first = program_.lines[line].first;
+    lines_.push_back({first, memory, bytes, compiler.fields()});
+    compilations_++;
+    entries_[first] = reinterpret_cast<JitFunction>(memory);
+    return entries_[first];
+}
+
+void Jit::release_(CompiledLine &line) noexcept{
+    entries_[line.first] = nullptr;
+    munmap(line.code, line.bytes);
+}
+
+void Jit::invalidate_field(unsigned field){
+    auto stale = [&](CompiledLine &line){
+        for(const auto &used : line.fields){
+            const FieldDefinition &current = runtime_.field(used.first);
+            if(used.first == field && (!runtime_.defined(field) || current.word != used.second.word
+                                       || current.shift != used.second.shift
+                                       || current.mask != used.second.mask
+                                       || current.layout != used.second.layout)){
+                release_(line);
+                return true;
+            }
+        }
+        return false;
+    };
+    lines_.erase(std::remove_if(lines_.begin(), lines_.end(), stale), lines_.end());
+}
+
+void Jit::invalidate_all(){
+    for(CompiledLine &line : lines_){
+        release_(line);
+    }
+    lines_.clear();
+}
+
+} // end namespace elsix
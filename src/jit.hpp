@@ -0,0 +1,131 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief A template JIT that compiles hot lines to x86-64 machine code.
+ *
+ * A line is compiled instruction by instruction from its first instruction until one the JIT
+ * does not handle, such as input and output or a call, where the compiled code returns to the
+ * interpreter. Tests, copies, arithmetic, and logic on bugs, literals, and fields are compiled.
+ * A jump back to the start of the line, as in a loop that is one line long, stays in machine
+ * code; any other jump returns to the interpreter with the target.
+ *
+ * Compiled code is specialized twice over. Each field access uses the shift and mask of the
+ * field's definition at compile time as immediates, so a redefinition of such a field by Df or a
+ * restore by FD discards the lines that used it. And addresses are translated inline against the
+ * single storage region, so setting up storage discards every line. Within a line the bugs it
+ * uses most live in callee-saved registers; the rest stay in memory. Operations are counted for
+ * the clock once per pass around the line or on leaving it, not one by one.
+ *
+ * Anything unusual at run time, such as a null pointer, an address outside the region's buddy
+ * storage, or a copy-on-write block, leaves compiled code before the instruction concerned has
+ * had any effect, and the interpreter executes it instead. So compiled code never faults itself.
+ *
+ * Code is written to a writable mapping that is then made executable and read-only, so that no
+ * page is ever both writable and executable.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "field.hpp"
+#include "program.hpp"
+
+namespace elsix{
+
+class Runtime;
+
+/// A compiled line. Given the bugs, returns the index of the instruction to continue at.
+using JitFunction = std::uint32_t (*)(Word *bugs);
+
+class Jit{
+public:
+    /// Bugs kept in registers within a compiled line: RBX and R12 through R15.
+    static constexpr unsigned PINNED_BUGS = 5;
+
+    Jit(const Program &program, Runtime &runtime);
+    ~Jit();
+    Jit(const Jit &) = delete;
+    Jit &operator=(const Jit &) = delete;
+
+    /// Can this machine run compiled code?
+    [[nodiscard]] static constexpr bool supported() noexcept{
+#if defined(__x86_64__)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// The compiled code of the line beginning at `instruction`, or null.
+    [[nodiscard]] JitFunction entry(std::uint32_t instruction) const noexcept{
+        return entries_[instruction];
+    }
+
+    /**
+     * @brief Compiles line `line` against the current storage and field definitions.
+     * @return The compiled code, or null if the line's first instruction cannot be compiled.
+     */
+    JitFunction compile(std::uint32_t line);
+
+    /// Discards lines specialized on a definition of `field` other than its current one.
+    void invalidate_field(unsigned field);
+
+    /// Discards every line.
+    void invalidate_all();
+
+    /// The number of lines compiled so far, including those since discarded.
+    [[nodiscard]] std::size_t compilations() const noexcept{
+        return compilations_;
+    }
+
+private:
+    struct CompiledLine{
+        std::uint32_t first;
+        void *code;
+        std::size_t bytes;
+        // The definitions the code was specialized on.
+        std::vector<std::pair<unsigned, FieldDefinition>> fields;
+    };
+
+    const Program &program_;
+    Runtime &runtime_;
+    std::vector<JitFunction> entries_;
+    std::vector<CompiledLine> lines_;
+    std::size_t compilations_ = 0;
+
+    void release_(CompiledLine &line) noexcept;
+};
+
+} // end namespace elsix
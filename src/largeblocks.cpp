@@ -0,0 +1,146 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "largeblocks.hpp"
+
+namespace elsix{
+
+Word LargeBlockAllocator::page_words() noexcept{
+    static const Word words = static_cast<Word>(sysconf(_SC_PAGESIZE)) / sizeof(Word);
+    return words;
+}
+
+void LargeBlockAllocator::setup(Word *base, Word words){
+    base_ = base;
+    free_extents_.clear();
+    mapped_pages_ = 0;
+    available_counts_.fill(0);
+    Word pages = words / page_words();
+    if(pages > 0){
+        free_extents_.emplace(0, pages);
+        count_extent_(pages, true);
+    }
+}
+
+bool LargeBlockAllocator::allocate(Word words, Word &offset){
+    Word pages = (words + page_words() - 1) / page_words();
+
+    // First fit. Large blocks are rare enough that the extent map stays short.
+    auto extent = free_extents_.begin();
+    while(free_extents_.end() != extent && extent->second < pages){
+        ++extent;
+    }
+    if(free_extents_.end() == extent){
+        return false;
+    }
+
+    Word first_page = extent->first;
+    void *start = base_ + first_page * page_words();
+    std::size_t length = pages * page_words() * sizeof(Word);
+    if(MAP_FAILED == mmap(start, length, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0)){
+        return false;
+    }
+
+    Word remaining = extent->second - pages;
+    count_extent_(extent->second, false);
+    free_extents_.erase(extent);
+    if(remaining > 0){
+        free_extents_.emplace(first_page + pages, remaining);
+        count_extent_(remaining, true);
+    }
+    mapped_pages_ += pages;
+    offset = first_page * page_words();
+    return true;
+}
+
+void LargeBlockAllocator::release(Word offset, Word words){
+    Word first_page = offset / page_words();
+    Word pages = (words + page_words() - 1) / page_words();
+
+    // Replacing the pages with a fresh inaccessible mapping, rather than unmapping them, keeps
+    // the window reserved.
+    mmap(base_ + offset, pages * page_words() * sizeof(Word), PROT_NONE,
+         MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE, -1, 0);
+    mapped_pages_ -= pages;
+
+    // Coalesce with the neighboring free ranges.
+    auto next = free_extents_.lower_bound(first_page);
+    if(free_extents_.end() != next && first_page + pages == next->first){
+        pages += next->second;
+        count_extent_(next->second, false);
+        next = free_extents_.erase(next);
+    }
+    if(free_extents_.begin() != next){
+        auto previous = std::prev(next);
+        if(previous->first + previous->second == first_page){
+            count_extent_(previous->second, false);
+            previous->second += pages;
+            count_extent_(previous->second, true);
+            return;
+        }
+    }
+    free_extents_.emplace_hint(next, first_page, pages);
+    count_extent_(pages, true);
+}
+
+Word LargeBlockAllocator::block_pages_(unsigned order) noexcept{
+    return ((Word{1} << order) + page_words() - 1) / page_words();
+}
+
+/// Adds or removes the blocks a free range of `pages` pages could hold to or from the counts.
+void LargeBlockAllocator::count_extent_(Word pages, bool adding) noexcept{
+    for(unsigned order = 0; order <= MAX_BLOCK_ORDER; order++){
+        Word blocks = pages / block_pages_(order);
+        if(adding){
+            available_counts_[order] += blocks;
+        } else{
+            available_counts_[order] -= blocks;
+        }
+    }
+}
+
+bool LargeBlockAllocator::verify_available_counts() const{
+    for(unsigned order = 0; order <= MAX_BLOCK_ORDER; order++){
+        Word blocks = 0;
+        for(const auto &extent : free_extents_){
+            blocks += extent.second / block_pages_(order);
+        }
+        if(blocks != available_counts_[order]){
+            return false;
+        }
+    }
+    return true;
+}
+
+} // end namespace elsix
@@ -0,0 +1,108 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief A page granular allocator for blocks too large for the buddy system.
+ *
+ * The allocator manages a window of reserved but inaccessible address space. Getting a block maps
+ * fresh zeroed pages over its part of the window, and freeing a block maps inaccessible pages
+ * back over it, which returns the memory to the operating system and makes a dangling pointer to
+ * a freed large block fault rather than read garbage. Because the window is never unmapped until
+ * the allocator is torn down, nothing else in the process can be mapped into it, and storage
+ * addresses within it translate to host addresses by an offset, just as small blocks do.
+ */
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <cstddef>
+
+#include "field.hpp"
+
+namespace elsix{
+
+/// The largest block is 2^20 words.
+constexpr unsigned MAX_BLOCK_ORDER = 20;
+
+class LargeBlockAllocator{
+public:
+    LargeBlockAllocator() = default;
+    ~LargeBlockAllocator() = default;
+
+    /// The number of words in a page of the host system.
+    [[nodiscard]] static Word page_words() noexcept;
+
+    /**
+     * @brief Takes over the reserved window `[base, base + words)`. Any previous window is
+     * forgotten; unmapping it is the owner's responsibility.
+     * @param base: Host address of the window, page aligned.
+     * @param words: Size of the window, a multiple of `page_words()`.
+     */
+    void setup(Word *base, Word words);
+
+    /**
+     * @brief Maps a zeroed block of at least `words` words.
+     * @param words: The size of the block.
+     * @param offset: Receives the offset of the block from the start of the window.
+     * @return False if the window has no free range large enough or the system refuses memory.
+     */
+    [[nodiscard]] bool allocate(Word words, Word &offset);
+
+    /// Unmaps the block of `words` words at `offset`, returning its pages to the system.
+    void release(Word offset, Word words);
+
+    /// The number of pages currently mapped for large blocks.
+    [[nodiscard]] std::size_t mapped_pages() const noexcept{
+        return mapped_pages_;
+    }
+
+    /// The number of blocks of 2^order words that could be allocated one after another.
+    [[nodiscard]] Word available_blocks(unsigned order) const noexcept{
+        return available_counts_[order];
+    }
+
+    /// Recomputes `available_blocks()` for every order from the free ranges. For debugging.
+    [[nodiscard]] bool verify_available_counts() const;
+
+private:
+    Word *base_ = nullptr;
+    // Free page ranges of the window, first page mapped to number of pages.
+    std::map<Word, Word> free_extents_;
+    std::size_t mapped_pages_ = 0;
+    // For each order, the sum over the free ranges of the blocks of that order each could hold.
+    // Blocks are page aligned, so a range holds as many as fit end to end.
+    std::array<Word, MAX_BLOCK_ORDER + 1> available_counts_{};
+
+    [[nodiscard]] static Word block_pages_(unsigned order) noexcept;
+    void count_extent_(Word pages, bool adding) noexcept;
+};
+
+} // end namespace elsix
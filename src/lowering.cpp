@@ -0,0 +1,500 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <variant>
+
+#include "fmt/format.h"
+
+#include "lowering.hpp"
+#include "error.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// The opcode of an operation node whose operands need no special treatment, or HALT.
+Opcode simple_opcode(NodeType type) noexcept{
+    switch(type){
+        case NodeType::SETUP_STORAGE:return Opcode::SETUP_STORAGE;
+        case NodeType::GET_BLOCK:return Opcode::GET_BLOCK;
+        case NodeType::FREE_BLOCK:return Opcode::FREE_BLOCK;
+        case NodeType::SET_EQUAL:return Opcode::SET_EQUAL;
+        case NodeType::DUPLICATE_BLOCK:return Opcode::DUPLICATE_BLOCK;
+        case NodeType::INTERCHANGE_CONTENTS:return Opcode::INTERCHANGE;
+        case NodeType::ADD:return Opcode::ADD;
+        case NodeType::SUBTRACT:return Opcode::SUBTRACT;
+        case NodeType::MULTIPLY:return Opcode::MULTIPLY;
+        case NodeType::DIVIDE:return Opcode::DIVIDE;
+        case NodeType::LOGICAL_OR:return Opcode::OR;
+        case NodeType::LOGICAL_AND:return Opcode::AND;
+        case NodeType::EXCLUSIVE_OR:return Opcode::EXCLUSIVE_OR;
+        case NodeType::COMPLEMENT:return Opcode::COMPLEMENT;
+        case NodeType::SHIFT_LEFT:return Opcode::SHIFT_LEFT;
+        case NodeType::SHIFT_RIGHT:return Opcode::SHIFT_RIGHT;
+        case NodeType::LEFT_ONES:return Opcode::LEFT_ONE;
+        case NodeType::LEFT_ZEROES:return Opcode::LEFT_ZERO;
+        case NodeType::RIGHT_ONES:return Opcode::RIGHT_ONE;
+        case NodeType::RIGHT_ZEROES:return Opcode::RIGHT_ZERO;
+        case NodeType::COUNT_ONES:return Opcode::COUNT_ONES;
+        case NodeType::COUNT_ZEROES:return Opcode::COUNT_ZEROES;
+        case NodeType::INPUT:return Opcode::INPUT;
+        case NodeType::PRINT:return Opcode::PRINT;
+        case NodeType::PUNCH:return Opcode::PUNCH;
+        case NodeType::BINARY_TO_DECIMAL:return Opcode::BINARY_TO_DECIMAL;
+        case NodeType::DECIMAL_TO_BINARY:return Opcode::DECIMAL_TO_BINARY;
+        case NodeType::BINARY_TO_OCTAL:return Opcode::BINARY_TO_OCTAL;
+        case NodeType::OCTAL_TO_BINARY:return Opcode::OCTAL_TO_BINARY;
+        case NodeType::BLANKS_TO_ZEROES:return Opcode::BLANKS_TO_ZEROES;
+        case NodeType::ZEROES_TO_BLANKS:return Opcode::ZEROES_TO_BLANKS;
+        case NodeType::X_RANGE:return Opcode::X_RANGE;
+        case NodeType::Y_RANGE:return Opcode::Y_RANGE;
+        case NodeType::DRAW_LINE:[[fallthrough]];
+        case NodeType::DRAW_POINT:return Opcode::DRAW;
+        case NodeType::TYPE_HORIZONTALLY:return Opcode::TYPE_HORIZONTALLY;
+        case NodeType::TYPE_VERTICALLY:return Opcode::TYPE_VERTICALLY;
+        case NodeType::SAVE_FIELD_CONTENTS:return Opcode::SAVE_FIELD_CONTENTS;
+        case NodeType::RESTORE_FIELD_CONTENTS:return Opcode::RESTORE_FIELD_CONTENTS;
+        default:return Opcode::HALT;
+    }
+}
+
+Opcode test_opcode(NodeType type) noexcept{
+    switch(type){
+        case NodeType::EQUALITY_TEST:return Opcode::TEST_EQUAL;
+        case NodeType::INEQUALITY_TEST:return Opcode::TEST_NOT_EQUAL;
+        case NodeType::GREATER_TEST:return Opcode::TEST_GREATER;
+        case NodeType::LESS_TEST:return Opcode::TEST_LESS;
+        case NodeType::POINTS_SAME_BLOCK_TEST:return Opcode::TEST_SAME_BLOCK;
+        case NodeType::ONE_BITS_OF_TEST:return Opcode::TEST_ONE_BITS;
+        case NodeType::ZERO_BITS_OF_TEST:return Opcode::TEST_ZERO_BITS;
+        default:return Opcode::HALT;
+    }
+}
+
+bool is_if(NodeType type) noexcept{
+    return NodeType::IFANY == type || NodeType::IFALL == type || NodeType::IFNALL == type
+           || NodeType::IFNONE == type;
+}
+
+} // end anonymous namespace
+
+std::string node_text(const ASTNode &node){
+    if(std::holds_alternative<std::string_view>(node.value)){
+        return std::string(std::get<std::string_view>(node.value));
+    }
+    if(std::holds_alternative<unsigned long>(node.value)){
+        return std::to_string(std::get<unsigned long>(node.value));
+    }
+    return std::string();
+}
+
+Lowering::Lowering(ErrorHandler &errors) : errors_(errors){
+}
+
+Program Lowering::lower(const ASTNode_sp &root){
+    program_ = Program();
+    label_references_.clear();
+    next_line_jumps_.clear();
+    // Operand 0 is the absent operand.
+    program_.operands.emplace_back();
+
+    for(const ASTNode_sp &line : root->children){
+        lower_line_(line);
+    }
+
+    // Falling through the last line ends the program.
+    for(std::uint32_t jump : next_line_jumps_){
+        program_.instructions[jump].target = static_cast<std::uint32_t>(
+            program_.instructions.size());
+    }
+    next_line_jumps_.clear();
+    Instruction halt;
+    halt.opcode = Opcode::HALT;
+    halt.line = line_;
+    emit_(halt);
+
+    resolve_labels_();
+    return std::move(program_);
+}
+
+void Lowering::lower_line_(const ASTNode_sp &line){
+    line_ = static_cast<std::uint32_t>(program_.lines.size());
+    auto first = static_cast<std::uint32_t>(program_.instructions.size());
+    for(std::uint32_t jump : next_line_jumps_){
+        program_.instructions[jump].target = first;
+    }
+    next_line_jumps_.clear();
+
+    LineInfo info;
+    info.first = first;
+    info.row = line->span.start.row;
+    info.column = static_cast<std::uint32_t>(line->span.start.column);
+    program_.lines.push_back(info);
+
+    for(const ASTNode_sp &child : line->children){
+        if(NodeType::LABEL == child->type){
+            std::string label = node_text(*child);
+            if(NO_INDEX != program_.find_label(label)){
+                errors_.emitError(fmt::format("The label {} is used more than once.", label),
+                                  child->span);
+            }
+            program_.lines[line_].label = static_cast<std::uint32_t>(program_.strings.size());
+            program_.lines[line_].label_length = static_cast<std::uint32_t>(label.size());
+            program_.strings += label;
+        } else if(is_if(child->type)){
+            lower_if_(child);
+        } else if(NodeType::THEN == child->type){
+            lower_then_(child);
+        } else if(NodeType::DONE == child->type || NodeType::FAIL == child->type){
+            lower_goto_(child);
+        } else{
+            errors_.emitError("Expected a label, an IF, or a THEN here.", child->span);
+        }
+    }
+}
+
+/**
+ * @brief Lowers the tests of an IF to a chain of compare-and-branch instructions that stops as
+ * soon as the outcome is known, followed by the body.
+ */
+void Lowering::lower_if_(const ASTNode_sp &if_node){
+    std::vector<ASTNode_sp> tests;
+    ASTNode_sp body;
+    for(const ASTNode_sp &child : if_node->children){
+        if(Opcode::HALT != test_opcode(child->type)){
+            tests.push_back(child);
+        } else{
+            body = child;
+        }
+    }
+
+    // For each kind of IF, where each test but the last jumps and when, and where the last
+    // jumps and when. The body follows the last test.
+    //          each test but the last      the last test
+    //  IFANY   true: to the body           false: to the next line
+    //  IFALL   false: to the next line     false: to the next line
+    //  IFNALL  false: to the body          true: to the next line
+    //  IFNONE  true: to the next line      true: to the next line
+    bool early_to_body = NodeType::IFANY == if_node->type || NodeType::IFNALL == if_node->type;
+    std::uint8_t early_flags = (NodeType::IFANY == if_node->type
+                                || NodeType::IFNONE == if_node->type) ? 0 : INVERT;
+    std::uint8_t last_flags = (NodeType::IFANY == if_node->type
+                               || NodeType::IFALL == if_node->type) ? INVERT : 0;
+
+    std::vector<std::uint32_t> body_jumps;
+    for(std::size_t i = 0; i < tests.size(); i++){
+        if(i + 1 < tests.size()){
+            lower_test_(tests[i], early_flags, early_to_body ? body_jumps : next_line_jumps_);
+        } else{
+            lower_test_(tests[i], last_flags, next_line_jumps_);
+        }
+    }
+    for(std::uint32_t jump : body_jumps){
+        program_.instructions[jump].target = static_cast<std::uint32_t>(
+            program_.instructions.size());
+    }
+
+    if(nullptr == body){
+        return;
+    }
+    if(NodeType::THEN == body->type){
+        lower_then_(body);
+    } else{
+        lower_goto_(body);
+    }
+}
+
+void Lowering::lower_test_(const ASTNode_sp &test, std::uint8_t flags,
+                           std::vector<std::uint32_t> &jumps){
+    Instruction instruction;
+    instruction.opcode = test_opcode(test->type);
+    instruction.flags = flags;
+    if(test->children.size() != 2){
+        errors_.emitError("A test takes two operands.", test->span);
+    }
+    for(std::size_t i = 0; i < test->children.size() && i < 2; i++){
+        instruction.operands[i] = operand_(test->children[i]);
+    }
+    instruction.operand_count = 2;
+    jumps.push_back(emit_(instruction));
+}
+
+void Lowering::lower_then_(const ASTNode_sp &then_node){
+    for(const ASTNode_sp &child : then_node->children){
+        if(child->children.empty() && NodeType::DO_OR_FAIL != child->type){
+            // A leaf is the goto that ends the line.
+            lower_goto_(child);
+        } else{
+            lower_operation_(child);
+        }
+    }
+}
+
+void Lowering::lower_goto_(const ASTNode_sp &node){
+    std::string label = node_text(*node);
+    Instruction instruction;
+    if(NodeType::DONE == node->type || "DONE" == label){
+        instruction.opcode = Opcode::RETURN_DONE;
+    } else if(NodeType::FAIL == node->type || "FAIL" == label){
+        instruction.opcode = Opcode::RETURN_FAIL;
+    } else{
+        instruction.opcode = Opcode::JUMP;
+        label_references_.push_back({emit_(instruction), false, label, node->span});
+        return;
+    }
+    emit_(instruction);
+}
+
+void Lowering::lower_call_(const ASTNode_sp &operation){
+    Instruction instruction;
+    // `(DO, s)` has the single child `s`; `(s2, DO, s)` has the children `s2` and `s`.
+    const ASTNode_sp &subroutine = operation->children.back();
+    switch(subroutine->type){
+        case NodeType::DO_DUMP:instruction.opcode = Opcode::DUMP;
+            break;
+        case NodeType::DO_STATE:instruction.opcode = Opcode::STATE;
+            break;
+        case NodeType::DO_ADVANCE:instruction.opcode = Opcode::ADVANCE;
+            break;
+        default:instruction.opcode = Opcode::CALL;
+            break;
+    }
+    std::uint32_t index = emit_(instruction);
+    if(Opcode::CALL != instruction.opcode){
+        return;
+    }
+    label_references_.push_back({index, false, node_text(*subroutine), subroutine->span});
+    if(operation->children.size() > 1){
+        const ASTNode_sp &alternate = operation->children.front();
+        label_references_.push_back({index, true, node_text(*alternate), alternate->span});
+    }
+}
+
+void Lowering::lower_operation_(const ASTNode_sp &operation){
+    if(NodeType::DO == operation->type || NodeType::DO_OR_FAIL == operation->type){
+        lower_call_(operation);
+        return;
+    }
+
+    Instruction instruction;
+    const auto &children = operation->children;
+    std::size_t count = children.size();
+    switch(operation->type){
+        case NodeType::DEFINE_FIELD:{
+            // The field is named by the second letter of the op code, as in `DA`.
+            std::string op_code = node_text(*operation);
+            instruction.opcode = Opcode::DEFINE_FIELD;
+            instruction.field = static_cast<std::uint8_t>(
+                field_index(op_code.size() == 2 ? op_code[1] : '\0'));
+            if(FIELD_COUNT == instruction.field){
+                errors_.emitError(fmt::format("{} does not name a field.", op_code),
+                                  operation->span);
+                instruction.field = 0;
+            }
+            break;
+        }
+        case NodeType::SAVE_FIELD_DEFINITION:[[fallthrough]];
+        case NodeType::RESTORE_FIELD_DEFINITION:
+            instruction.opcode = (NodeType::SAVE_FIELD_DEFINITION == operation->type)
+                                 ? Opcode::SAVE_FIELD_DEFINITION
+                                 : Opcode::RESTORE_FIELD_DEFINITION;
+            instruction.field = static_cast<std::uint8_t>(
+                count > 0 ? field_(children.back()) : 0);
+            emit_(instruction);
+            return;
+        case NodeType::GET_CHAIN:{
+            // `(a, GL, cd, n, f)` or `(a, GL, cd, n, fb)`: the field names are packed into a
+            // literal, each as its index plus one.
+            instruction.opcode = Opcode::GET_CHAIN;
+            if(count != 4){
+                errors_.emitError("Get Chain takes four operands.", operation->span);
+                return;
+            }
+            for(unsigned i = 0; i < 3; i++){
+                instruction.operands[i] = operand_(children[i]);
+            }
+            std::string names = node_text(*children[3]);
+            Word packed = 0;
+            for(std::size_t i = 0; i < names.size() && i < 2; i++){
+                unsigned field = field_index(names[i]);
+                if(FIELD_COUNT == field){
+                    errors_.emitError(fmt::format("{} does not name a field.", names),
+                                      children[3]->span);
+                }
+                packed |= Word{field + 1} << (8 * i);
+            }
+            instruction.operands[3] = literal_(packed);
+            instruction.operand_count = 4;
+            emit_(instruction);
+            return;
+        }
+        case NodeType::PRINT_LIST:
+            instruction.opcode = Opcode::PRINT_LIST;
+            if(count < 2 || count > 3){
+                errors_.emitError("Print List takes two or three operands.", operation->span);
+                return;
+            }
+            instruction.operands[0] = operand_(children[0]);
+            instruction.operands[1] = literal_(field_(children[1]));
+            if(3 == count){
+                instruction.operands[2] = operand_(children[2]);
+            }
+            instruction.operand_count = static_cast<std::uint8_t>(count);
+            emit_(instruction);
+            return;
+        case NodeType::POINT_TO_SAME_AS:
+            instruction.opcode = Opcode::POINT;
+            if(2 == count && children[1]->type != NodeType::CONTENTS_LITERAL){
+                // `(a, Δ)` abbreviates `(a, P, aΔ)`.
+                instruction.operands[0] = operand_(children[0]);
+                Operand source = program_.operands[instruction.operands[0]];
+                if(OperandKind::BUG != source.kind && OperandKind::FIELD != source.kind){
+                    errors_.emitError("Only a bug or a field can be advanced.", operation->span);
+                    return;
+                }
+                auto path = static_cast<std::uint32_t>(program_.paths.size());
+                for(unsigned i = 0; i < source.length; i++){
+                    program_.paths.push_back(program_.paths[source.path + i]);
+                }
+                program_.paths.push_back(static_cast<std::uint8_t>(field_(children[1])));
+                source.kind = OperandKind::FIELD;
+                source.path = path;
+                source.length++;
+                program_.operands.push_back(source);
+                instruction.operands[1] = static_cast<std::uint32_t>(program_.operands.size() - 1);
+                instruction.operand_count = 2;
+                emit_(instruction);
+                return;
+            }
+            break;
+        default:
+            instruction.opcode = simple_opcode(operation->type);
+            if(Opcode::HALT == instruction.opcode){
+                errors_.emitError("This operation is not supported here.", operation->span);
+                return;
+            }
+            break;
+    }
+
+    if(count > instruction.operands.size()){
+        errors_.emitError("An operation has at most five operands.", operation->span);
+        count = instruction.operands.size();
+    }
+    for(std::size_t i = 0; i < count; i++){
+        instruction.operands[i] = operand_(children[i]);
+    }
+    instruction.operand_count = static_cast<std::uint8_t>(count);
+
+    if(writes_operand0(instruction.opcode) && count > 0){
+        OperandKind kind = program_.operands[instruction.operands[0]].kind;
+        if(OperandKind::BUG != kind && OperandKind::FIELD != kind){
+            errors_.emitError("The result must go to a bug or a field.", children[0]->span);
+        }
+    }
+    emit_(instruction);
+}
+
+std::uint32_t Lowering::emit_(Instruction instruction){
+    instruction.line = line_;
+    program_.instructions.push_back(instruction);
+    return static_cast<std::uint32_t>(program_.instructions.size() - 1);
+}
+
+std::uint32_t Lowering::literal_(Word value){
+    Operand operand;
+    operand.kind = OperandKind::LITERAL;
+    operand.value = value;
+    program_.operands.push_back(operand);
+    return static_cast<std::uint32_t>(program_.operands.size() - 1);
+}
+
+std::uint32_t Lowering::operand_(const ASTNode_sp &node){
+    Operand operand;
+    switch(node->type){
+        case NodeType::NUMBER_LITERAL:
+            return literal_(node->value_as_long());
+        case NodeType::T_DOT:
+            operand.kind = OperandKind::CLOCK;
+            break;
+        case NodeType::N_DOT:
+            operand.kind = OperandKind::AVAILABLE;
+            operand.value = node->value_as_long();
+            break;
+        default:{
+            std::string name = node_text(*node);
+            if(name.empty() || field_index(name[0]) < 10){
+                errors_.emitError(fmt::format("{} is not a bug or a field.", name), node->span);
+                return literal_(0);
+            }
+            operand.bug = static_cast<std::uint8_t>(field_index(name[0]) - 10);
+            operand.kind = (1 == name.size()) ? OperandKind::BUG : OperandKind::FIELD;
+            operand.path = static_cast<std::uint32_t>(program_.paths.size());
+            operand.length = static_cast<std::uint8_t>(name.size() - 1);
+            for(std::size_t i = 1; i < name.size(); i++){
+                unsigned field = field_index(name[i]);
+                if(FIELD_COUNT == field){
+                    errors_.emitError(fmt::format("{} is not a bug or a field.", name),
+                                      node->span);
+                    field = 0;
+                }
+                program_.paths.push_back(static_cast<std::uint8_t>(field));
+            }
+            break;
+        }
+    }
+    program_.operands.push_back(operand);
+    return static_cast<std::uint32_t>(program_.operands.size() - 1);
+}
+
+unsigned Lowering::field_(const ASTNode_sp &node){
+    std::string name = node_text(*node);
+    unsigned field = (1 == name.size()) ? field_index(name[0]) : FIELD_COUNT;
+    if(FIELD_COUNT == field){
+        errors_.emitError(fmt::format("{} is not a field name.", name), node->span);
+        return 0;
+    }
+    return field;
+}
+
+void Lowering::resolve_labels_(){
+    for(const LabelReference &reference : label_references_){
+        std::uint32_t line = program_.find_label(reference.label);
+        if(NO_INDEX == line){
+            errors_.emitError(fmt::format("No line is labeled {}.", reference.label),
+                              reference.span);
+            continue;
+        }
+        Instruction &instruction = program_.instructions[reference.instruction];
+        std::uint32_t &target = reference.alternate ? instruction.alternate : instruction.target;
+        target = program_.lines[line].first;
+    }
+}
+
+} // end namespace elsix
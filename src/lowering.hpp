@@ -0,0 +1,99 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Lowers the AST produced by `parser::parse()` to a `Program`.
+ *
+ * The AST is expected in the shape the parser builds: a PROGRAM node whose children are LINE
+ * nodes; a LINE holds an optional LABEL, then an IF node (IFANY, IFALL, IFNALL, or IFNONE) whose
+ * children are its tests followed by a THEN node or a goto, or a THEN node whose children are
+ * operations followed by an optional goto, or the keyword DONE or FAIL. Tests and operations have
+ * their operands as children. A goto is a leaf holding a label.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "astnode.hpp"
+#include "program.hpp"
+
+namespace elsix{
+
+class ErrorHandler;
+
+class Lowering{
+public:
+    explicit Lowering(ErrorHandler &errors);
+
+    /**
+     * @brief Lowers the program rooted at `root`. Problems are reported to the error handler,
+     * and the instructions concerned are left as they can best be made.
+     */
+    [[nodiscard]] Program lower(const ASTNode_sp &root);
+
+private:
+    ErrorHandler &errors_;
+    Program program_;
+    std::uint32_t line_ = 0;
+
+    // A jump to a label, resolved once every line has been lowered.
+    struct LabelReference{
+        std::uint32_t instruction;
+        bool alternate;
+        std::string label;
+        Span span;
+    };
+    std::vector<LabelReference> label_references_;
+    // Jumps to the start of the next line, resolved when it begins.
+    std::vector<std::uint32_t> next_line_jumps_;
+
+    void lower_line_(const ASTNode_sp &line);
+    void lower_if_(const ASTNode_sp &if_node);
+    void lower_then_(const ASTNode_sp &then_node);
+    void lower_goto_(const ASTNode_sp &node);
+    void lower_test_(const ASTNode_sp &test, std::uint8_t flags, std::vector<std::uint32_t> &jumps);
+    void lower_operation_(const ASTNode_sp &operation);
+    void lower_call_(const ASTNode_sp &operation);
+
+    std::uint32_t emit_(Instruction instruction);
+    std::uint32_t operand_(const ASTNode_sp &node);
+    std::uint32_t literal_(Word value);
+    /// The index of the field named by the node, such as `1` in `(S, FD, 1)`.
+    unsigned field_(const ASTNode_sp &node);
+    void resolve_labels_();
+};
+
+/// The text of a leaf node, or its number as text.
+[[nodiscard]] std::string node_text(const ASTNode &node);
+
+} // end namespace elsix
@@ -0,0 +1,304 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The `elsix` command.
+ *
+ *     elsix [--no-jit] [runtime options] program.l6 [input deck]
+ *     elsix --compile executable program.l6
+ *     elsix --emit-cpp translation.cpp program.l6
+ *     elsix --dump-ir program.l6
+ *     elsix --save-image program.l6c program.l6
+ *     elsix --mine-sequences program.l6...
+ *
+ * and, to order the tests of compound conditions by how a run of the program went,
+ *
+ *     elsix --profile profile.txt program.l6 [input deck]
+ *     elsix --use-profile profile.txt ... program.l6 ...
+ *
+ * By default the program is run by the interpreter, which compiles hot lines to machine code
+ * unless `--no-jit` is given. `--compile` translates the program to C++ and builds it into a
+ * native executable with the system compiler; the C++ is kept beside the executable.
+ * `--emit-cpp` only translates. `--mine-sequences` lists the instruction sequences that occur
+ * most often in a corpus of programs, as candidates for superinstructions (see fusion.hpp).
+ * `--dump-ir` lists the program in registers after local optimization, with the number of
+ * instructions of each line before and after (see registerir.hpp). `--save-image` writes the
+ * program ready to run as an image, which any mode but `--mine-sequences` takes in place of the
+ * source and loads without parsing it (see image.hpp).
+ * `--profile` interprets the program without the JIT and records how often each test ran and
+ * jumped; `--use-profile` reorders tests by such a record in any mode (see conditions.hpp).
+ * `--checks=full`, `--checks=proven`, the default, and `--checks=none` choose which field
+ * accesses are checked in any mode (see verifier.hpp). Both apply when an image is written, not
+ * when one is read.
+ *
+ * The runtime options, which natively compiled programs take as well, are `--deterministic`,
+ * `--punch file`, `--punch-format=text|codes|column-binary`, which punches a binary deck (see
+ * cardformat.hpp) instead of lines of text, `--asynchronous-output`, which writes the printer and
+ * punch output on a thread of its own, and `--copy-on-write`, which defers the copying done by
+ * Duplicate Block (see storageregion.hpp). The last two report on standard error how long the
+ * program waited for output and how much was copied (see runtime.hpp). `--pin-bug X=address` gets
+ * the blocks of bug X from the region that begins at the octal address (see storage.hpp),
+ * `--first-card n` starts the input at card n of the deck, counting from 0 (see cardio.hpp), and
+ * `--detect-cycles` stops Print List at a list that loops back on itself (see printlist.hpp).
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "tokenstream.hpp"
+#include "parser.hpp"
+#include "error.hpp"
+#include "lowering.hpp"
+#include "transpiler.hpp"
+#include "interpreter.hpp"
+#include "fusion.hpp"
+#include "controlflow.hpp"
+#include "conditions.hpp"
+#include "verifier.hpp"
+#include "registerir.hpp"
+#include "image.hpp"
+
+namespace{
+
+int usage(){
+    std::cerr << "Usage: elsix [--no-jit] [runtime options] program.l6 [deck]\n"
+                 "       elsix --compile executable program.l6\n"
+                 "       elsix --emit-cpp translation.cpp program.l6\n"
+                 "       elsix --dump-ir program.l6\n"
+                 "       elsix --save-image program.l6c program.l6\n"
+                 "       elsix --mine-sequences program.l6...\n"
+                 "       elsix --profile profile.txt program.l6 [deck]\n"
+                 "Any mode but the last two takes --use-profile profile.txt, and any but\n"
+                 "--mine-sequences takes --checks=full|proven|none. Any but --mine-sequences\n"
+                 "takes an image, program.l6c, in place of program.l6, but then neither\n"
+                 "--use-profile nor --checks. The runtime options are --deterministic,\n"
+                 "--punch file, --punch-format=text|codes|column-binary,\n"
+                 "--asynchronous-output, --copy-on-write, --pin-bug X=address,\n"
+                 "--first-card n, and --detect-cycles." << std::endl;
+    return 2;
+}
+
+/// Parses and lowers the program in `path`. Returns false if it cannot be read or has errors.
+bool load(const std::string &path, elsix::Program &program){
+    using namespace elsix;
+    if(!std::ifstream(path)){
+        std::cerr << "Cannot read " << path << std::endl;
+        return false;
+    }
+    try{
+        TokenStream tokens(path);
+        parser program_parser(std::move(tokens));
+        ASTNode_sp root = program_parser.parse();
+        // A tree with errors in it has error nodes where the lowering expects operations.
+        if(!program_parser.error_handler().getErrors().empty()){
+            return false;
+        }
+        ErrorHandler errors;
+        program = Lowering(errors).lower(root);
+        return errors.getErrors().empty();
+    } catch(const FatalException &){
+        // The handler has already reported the error.
+        return false;
+    }
+}
+
+/// Loads the program in `path` and runs the passes over it. Returns false if it cannot.
+bool prepare(const std::string &path, const std::string &use_profile_path, elsix::Checks checks,
+             elsix::Program &program){
+    using namespace elsix;
+    if(!load(path, program)){
+        return false;
+    }
+    optimize_control_flow(program);
+    simplify_instructions(program);
+    if(!use_profile_path.empty()){
+        TestProfile profile(program);
+        if(!profile.load(program, use_profile_path)){
+            std::cerr << "Could not read " << use_profile_path << std::endl;
+            return false;
+        }
+        order_tests(program, profile);
+    }
+    compile_ladders(program);
+    verify(program, checks);
+    return true;
+}
+
+/// The number of sequences `--mine-sequences` lists.
+constexpr std::size_t MINED_SEQUENCES = 30;
+
+int mine_sequences(const std::vector<std::string> &paths){
+    elsix::SequenceMiner miner;
+    for(const std::string &path : paths){
+        elsix::Program program;
+        if(!load(path, program)){
+            std::cerr << "Skipping " << path << ", which has errors." << std::endl;
+            continue;
+        }
+        miner.add(program);
+    }
+    for(const auto &sequence : miner.frequent(MINED_SEQUENCES)){
+        std::cout << sequence.second << '\t' << sequence.first << '\n';
+    }
+    return 0;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char **argv){
+    using namespace elsix;
+
+    if(argc > 1 && 0 == std::strcmp(argv[1], "--mine-sequences")){
+        return mine_sequences(std::vector<std::string>(argv + 2, argv + argc));
+    }
+
+    std::string compile_path;
+    std::string emit_path;
+    std::string program_path;
+    std::string profile_path;
+    std::string use_profile_path;
+    std::string image_path;
+    RuntimeOptions options;
+    Checks checks = Checks::PROVEN;
+    bool checks_given = false;
+    bool jit = true;
+    bool dump_ir = false;
+    for(int i = 1; i < argc; i++){
+        int parsed = parse_runtime_option(argc, argv, i, options);
+        if(parsed < 0){
+            return EXIT_FAULT;
+        }
+        if(parsed > 0){
+            continue;
+        }
+        if(0 == std::strcmp(argv[i], "--compile") && i + 1 < argc){
+            compile_path = argv[++i];
+        } else if(0 == std::strcmp(argv[i], "--emit-cpp") && i + 1 < argc){
+            emit_path = argv[++i];
+        } else if(0 == std::strcmp(argv[i], "--profile") && i + 1 < argc){
+            profile_path = argv[++i];
+        } else if(0 == std::strcmp(argv[i], "--use-profile") && i + 1 < argc){
+            use_profile_path = argv[++i];
+        } else if(0 == std::strcmp(argv[i], "--save-image") && i + 1 < argc){
+            image_path = argv[++i];
+        } else if(0 == std::strncmp(argv[i], "--checks=", 9)){
+            if(!parse_checks(argv[i] + 9, checks)){
+                return usage();
+            }
+            checks_given = true;
+        } else if(0 == std::strcmp(argv[i], "--no-jit")){
+            jit = false;
+        } else if(0 == std::strcmp(argv[i], "--dump-ir")){
+            dump_ir = true;
+        } else if(0 == std::strncmp(argv[i], "--", 2)){
+            // An unknown option, or a known one missing its argument, such as `--help`.
+            return usage();
+        } else if(program_path.empty()){
+            program_path = argv[i];
+        } else if(nullptr == options.input_path){
+            options.input_path = argv[i];
+        } else{
+            return usage();
+        }
+    }
+    if(program_path.empty()
+       || (!profile_path.empty() && (!use_profile_path.empty() || !compile_path.empty()
+                                     || !emit_path.empty()))
+       || (dump_ir && (!profile_path.empty() || !compile_path.empty() || !emit_path.empty()))
+       || (!image_path.empty() && (dump_ir || !profile_path.empty() || !compile_path.empty()
+                                   || !emit_path.empty()))){
+        return usage();
+    }
+
+    Program program;
+    ImageStatus image = load_image(program_path, program);
+    if(ImageStatus::LOADED == image){
+        if(!use_profile_path.empty() || checks_given){
+            return usage();
+        }
+    } else if(ImageStatus::NOT_AN_IMAGE == image){
+        if(!prepare(program_path, use_profile_path, checks, program)){
+            return 1;
+        }
+    } else{
+        std::cerr << program_path
+                  << ((ImageStatus::WRONG_VERSION == image) ? " is an image from another Elsix."
+                                                             : " is a damaged image.")
+                  << std::endl;
+        return 1;
+    }
+
+    if(!image_path.empty()){
+        if(!save_image(program, image_path)){
+            std::cerr << "Could not write " << image_path << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    if(dump_ir){
+        RegisterProgram original = to_registers(program);
+        RegisterProgram optimized = original;
+        optimize_registers(program, optimized);
+        std::cout << listing(program, original, optimized);
+        return 0;
+    }
+    if(!profile_path.empty()){
+        fuse(program);
+        TestProfile profile(program);
+        int status = interpret(program, options, false, &profile);
+        if(!profile.save(program, profile_path)){
+            std::cerr << "Could not write " << profile_path << std::endl;
+            return 1;
+        }
+        return status;
+    }
+    if(compile_path.empty() && emit_path.empty()){
+        fuse(program);
+        return interpret(program, options, jit);
+    }
+
+    std::string source = Transpiler(program).translate();
+    if(!emit_path.empty() && !write_translation(source, emit_path)){
+        std::cerr << "Could not write " << emit_path << std::endl;
+        return 1;
+    }
+    if(!compile_path.empty()){
+        std::string source_path = compile_path + ".cpp";
+        if(!write_translation(source, source_path)
+           || !compile_native(source_path, compile_path, default_compiler_options())){
+            std::cerr << "Could not build " << compile_path << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
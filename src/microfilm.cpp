@@ -0,0 +1,552 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "fmt/format.h"
+
+#include "microfilm.hpp"
+#include "charset.hpp"
+
+namespace elsix{
+
+namespace{
+
+// region: Font
+
+constexpr std::int32_t GLYPH_COLUMNS = 5;
+constexpr std::int32_t GLYPH_ROWS = 7;
+// A character cell leaves a blank column and a blank row around the glyph.
+constexpr std::int32_t CELL_WIDTH = GLYPH_COLUMNS + 1;
+constexpr std::int32_t CELL_HEIGHT = GLYPH_ROWS + 1;
+
+/// A 5 by 7 font for ASCII space through underscore. Each glyph is five columns, left to right,
+/// with the top row in the low order bit.
+constexpr std::array<std::array<std::uint8_t, GLYPH_COLUMNS>, 64> FONT{{
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, // space !
+    {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14}, // " #
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, // $ %
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, // & '
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00}, // ( )
+    {0x14, 0x08, 0x3E, 0x08, 0x14}, {0x08, 0x08, 0x3E, 0x08, 0x08}, // * +
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, // , -
+    {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02}, // . /
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, // 0 1
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, // 2 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39}, // 4 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, // 6 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, // 8 9
+    {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00}, // : ;
+    {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, // < =
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, // > ?
+    {0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E}, // @ A
+    {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22}, // B C
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, // D E
+    {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A}, // F G
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, // H I
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, // J K
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F}, // L M
+    {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E}, // N O
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, // P Q
+    {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31}, // R S
+    {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, // T U
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, // V W
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07}, // X Y
+    {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00}, // Z [
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, // \ ]
+    {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40}  // ^ _
+}};
+
+// endregion: Font
+
+constexpr std::uint8_t INK = 0;
+constexpr std::uint8_t PAPER = 255;
+
+// Display list entries are binned as the kind of primitive in the high bits and its index.
+constexpr std::uint32_t SEGMENT_ENTRY = 0U << 30;
+constexpr std::uint32_t POINT_ENTRY = 1U << 30;
+constexpr std::uint32_t TEXT_ENTRY = 2U << 30;
+constexpr std::uint32_t ENTRY_KIND = 3U << 30;
+
+/// `numerator / denominator` rounded to nearest, halves away from zero.
+std::int64_t divide_rounded(std::int64_t numerator, std::int64_t denominator) noexcept{
+    if(denominator < 0){
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+    std::int64_t half = denominator / 2;
+    return (numerator >= 0) ? (numerator + half) / denominator
+                            : -((half - numerator) / denominator);
+}
+
+/// A tile of the frame being rasterized: the pixels are those of the whole frame, but only
+/// pixels within the tile may be set.
+struct Tile{
+    std::uint8_t *pixels;
+    std::int32_t stride;
+    std::int32_t left, top, right, bottom; // right and bottom are exclusive
+
+    void plot(std::int32_t x, std::int32_t y) const noexcept{
+        if(x >= left && x < right && y >= top && y < bottom){
+            pixels[static_cast<std::size_t>(y) * stride + x] = INK;
+        }
+    }
+
+    void fill(std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1) const noexcept{
+        x0 = std::max(x0, left);
+        y0 = std::max(y0, top);
+        x1 = std::min(x1, right);
+        y1 = std::min(y1, bottom);
+        for(std::int32_t y = y0; y < y1; y++){
+            std::fill(pixels + static_cast<std::size_t>(y) * stride + x0,
+                      pixels + static_cast<std::size_t>(y) * stride + std::max(x0, x1), INK);
+        }
+    }
+
+    /// Draws the pixels of a line that fall in the tile. Each pixel along the major axis is placed
+    /// independently, so adjoining tiles agree.
+    void line(std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1) const noexcept{
+        std::int64_t dx = x1 - x0;
+        std::int64_t dy = y1 - y0;
+        if(0 == dx && 0 == dy){
+            plot(x0, y0);
+            return;
+        }
+        if(std::abs(dx) >= std::abs(dy)){
+            std::int32_t first = std::max(std::min(x0, x1), left);
+            std::int32_t last = std::min(std::max(x0, x1), right - 1);
+            for(std::int32_t x = first; x <= last; x++){
+                plot(x, static_cast<std::int32_t>(y0 + divide_rounded((x - x0) * dy, dx)));
+            }
+        } else{
+            std::int32_t first = std::max(std::min(y0, y1), top);
+            std::int32_t last = std::min(std::max(y0, y1), bottom - 1);
+            for(std::int32_t y = first; y <= last; y++){
+                plot(static_cast<std::int32_t>(x0 + divide_rounded((y - y0) * dx, dy)), y);
+            }
+        }
+    }
+
+    /// Draws a character whose cell has its lower left corner at `x`, `y`.
+    void glyph(char c, std::int32_t x, std::int32_t y, std::int32_t scale) const noexcept{
+        unsigned index = static_cast<unsigned char>(c) - unsigned{' '};
+        if(index >= FONT.size()){
+            index = '?' - ' ';
+        }
+        std::int32_t top_row = y - CELL_HEIGHT * scale + 1;
+        for(std::int32_t column = 0; column < GLYPH_COLUMNS; column++){
+            std::uint8_t bits = FONT[index][column];
+            for(std::int32_t row = 0; row < GLYPH_ROWS; row++){
+                if(0 != (bits >> row & 1)){
+                    std::int32_t px = x + column * scale;
+                    std::int32_t py = top_row + row * scale;
+                    fill(px, py, px + scale, py + scale);
+                }
+            }
+        }
+    }
+};
+
+bool write_file(const std::string &path, const char *data, std::size_t size){
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0){
+        return false;
+    }
+    while(size > 0){
+        ssize_t written = ::write(fd, data, size);
+        if(written < 0 && EINTR == errno){
+            continue;
+        }
+        if(written < 0){
+            ::close(fd);
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return 0 == ::close(fd);
+}
+
+// region: PNG encoding
+
+constexpr std::array<std::uint32_t, 256> CRC_TABLE = [](){
+    std::array<std::uint32_t, 256> table{};
+    for(std::uint32_t n = 0; n < 256; n++){
+        std::uint32_t c = n;
+        for(int k = 0; k < 8; k++){
+            c = (c & 1) ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}();
+
+void append_u32(std::string &out, std::uint32_t value){
+    out.push_back(static_cast<char>(value >> 24));
+    out.push_back(static_cast<char>(value >> 16));
+    out.push_back(static_cast<char>(value >> 8));
+    out.push_back(static_cast<char>(value));
+}
+
+/// Completes the chunk begun at `length_position` by `start_chunk()`, whose data is the rest of
+/// `out`: fills in its length and appends its CRC.
+void finish_chunk(std::string &out, std::size_t length_position){
+    std::size_t data_start = length_position + 8;
+    auto length = static_cast<std::uint32_t>(out.size() - data_start);
+    for(int i = 0; i < 4; i++){
+        out[length_position + i] = static_cast<char>(length >> (24 - 8 * i));
+    }
+    std::uint32_t crc = 0xFFFFFFFFU;
+    for(std::size_t i = length_position + 4; i < out.size(); i++){
+        crc = CRC_TABLE[(crc ^ static_cast<std::uint8_t>(out[i])) & 0xFF] ^ (crc >> 8);
+    }
+    append_u32(out, crc ^ 0xFFFFFFFFU);
+}
+
+std::size_t start_chunk(std::string &out, const char *type){
+    std::size_t length_position = out.size();
+    append_u32(out, 0);
+    out.append(type, 4);
+    return length_position;
+}
+
+/**
+ * @brief Encodes a grayscale image as a PNG. The image data is stored without compression, which
+ * is valid PNG and keeps encoding as fast as copying.
+ */
+std::string encode_png(const std::uint8_t *pixels, std::uint32_t width, std::uint32_t height){
+    std::string out("\x89PNG\r\n\x1a\n", 8);
+
+    std::size_t chunk = start_chunk(out, "IHDR");
+    append_u32(out, width);
+    append_u32(out, height);
+    out.append("\x08\x00\x00\x00\x00", 5); // 8 bit grayscale, no interlacing
+    finish_chunk(out, chunk);
+
+    // The raw data is each row preceded by filter type 0.
+    std::string raw;
+    raw.reserve(static_cast<std::size_t>(width + 1) * height);
+    for(std::uint32_t row = 0; row < height; row++){
+        raw.push_back('\0');
+        raw.append(reinterpret_cast<const char *>(pixels) + static_cast<std::size_t>(row) * width,
+                   width);
+    }
+
+    chunk = start_chunk(out, "IDAT");
+    out.append("\x78\x01", 2); // zlib header
+    constexpr std::size_t STORED_BLOCK_BYTES = 65535;
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    for(std::size_t position = 0; position < raw.size(); position += STORED_BLOCK_BYTES){
+        std::size_t length = std::min(STORED_BLOCK_BYTES, raw.size() - position);
+        out.push_back(position + length == raw.size() ? '\1' : '\0');
+        out.push_back(static_cast<char>(length & 0xFF));
+        out.push_back(static_cast<char>(length >> 8));
+        out.push_back(static_cast<char>(~length & 0xFF));
+        out.push_back(static_cast<char>((~length >> 8) & 0xFF));
+        out.append(raw, position, length);
+        // Adler-32, reduced once per block, well before it could overflow.
+        for(std::size_t i = position; i < position + length; i++){
+            a += static_cast<std::uint8_t>(raw[i]);
+            b += a;
+            if(0 == (i & 4095)){
+                a %= 65521;
+                b %= 65521;
+            }
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    append_u32(out, (b << 16) | a);
+    finish_chunk(out, chunk);
+
+    chunk = start_chunk(out, "IEND");
+    finish_chunk(out, chunk);
+    return out;
+}
+
+// endregion: PNG encoding
+
+} // end anonymous namespace
+
+Microfilm::Microfilm(std::string path_prefix, MicrofilmFormat format, unsigned resolution)
+    : path_prefix_(std::move(path_prefix)), format_(format), resolution_(resolution),
+      thread_count_(std::max(1U, std::thread::hardware_concurrency())),
+      x_maximum_(resolution - 1), y_maximum_(resolution - 1){
+}
+
+void Microfilm::set_x_range(Word minimum, Word maximum) noexcept{
+    x_minimum_ = minimum;
+    x_maximum_ = (maximum == minimum) ? minimum + 1 : maximum;
+}
+
+void Microfilm::set_y_range(Word minimum, Word maximum) noexcept{
+    y_minimum_ = minimum;
+    y_maximum_ = (maximum == minimum) ? minimum + 1 : maximum;
+}
+
+std::int32_t Microfilm::to_column_(Word x) const noexcept{
+    double scaled = (static_cast<double>(x) - static_cast<double>(x_minimum_))
+                    / (static_cast<double>(x_maximum_) - static_cast<double>(x_minimum_))
+                    * (resolution_ - 1);
+    // Far off the frame is as good as infinitely far, and keeps the arithmetic in range.
+    return static_cast<std::int32_t>(std::lround(std::clamp(scaled, -1e8, 1e8)));
+}
+
+std::int32_t Microfilm::to_row_(Word y) const noexcept{
+    double scaled = (static_cast<double>(y) - static_cast<double>(y_minimum_))
+                    / (static_cast<double>(y_maximum_) - static_cast<double>(y_minimum_))
+                    * (resolution_ - 1);
+    return static_cast<std::int32_t>(resolution_ - 1)
+           - static_cast<std::int32_t>(std::lround(std::clamp(scaled, -1e8, 1e8)));
+}
+
+std::int32_t Microfilm::glyph_scale_() const noexcept{
+    return std::max(1, static_cast<std::int32_t>(resolution_ / 512));
+}
+
+void Microfilm::draw_line(Word x0, Word y0, Word x1, Word y1){
+    segments_.push_back({to_column_(x0), to_row_(y0), to_column_(x1), to_row_(y1)});
+}
+
+void Microfilm::draw_point(Word x, Word y){
+    points_.push_back({to_column_(x), to_row_(y)});
+}
+
+void Microfilm::type(Word x, Word y, Word characters, unsigned count, bool vertical){
+    count = std::min(count, CHARACTERS_PER_WORD);
+    auto first = static_cast<std::uint32_t>(text_characters_.size());
+    for(unsigned i = count; i > 0; i--){
+        text_characters_.push_back(
+            DEFAULT_CHARACTERS.to_ascii[(characters >> ((i - 1) * CHARACTER_BITS)) & CHARACTER_MASK]
+        );
+    }
+    texts_.push_back({to_column_(x), to_row_(y), first, static_cast<std::uint16_t>(count),
+                      vertical});
+}
+
+bool Microfilm::advance(){
+    std::string path = fmt::format("{}{:04}.{}", path_prefix_, frame_ + 1,
+                                   MicrofilmFormat::PNG == format_ ? "png" : "svg");
+    bool written = (MicrofilmFormat::PNG == format_) ? render_png_(path) : render_svg_(path);
+
+    segments_.clear();
+    points_.clear();
+    texts_.clear();
+    text_characters_.clear();
+    frame_++;
+    return written;
+}
+
+// region: PNG rendering
+
+void Microfilm::bin_primitives_(std::vector<std::vector<std::uint32_t>> &bins) const{
+    auto tiles = static_cast<std::int32_t>((resolution_ + TILE_SIZE - 1) / TILE_SIZE);
+    auto tile_size = static_cast<std::int32_t>(TILE_SIZE);
+    auto last_pixel = static_cast<std::int32_t>(resolution_) - 1;
+
+    // Adds the entry to every tile overlapping the pixel rectangle, which is inclusive.
+    auto bin_rectangle = [&](std::uint32_t entry, std::int32_t x0, std::int32_t y0,
+                             std::int32_t x1, std::int32_t y1){
+        if(x1 < 0 || y1 < 0 || x0 > last_pixel || y0 > last_pixel){
+            return;
+        }
+        std::int32_t first_column = std::max(x0, 0) / tile_size;
+        std::int32_t last_column = std::min(x1, last_pixel) / tile_size;
+        std::int32_t first_row = std::max(y0, 0) / tile_size;
+        std::int32_t last_row = std::min(y1, last_pixel) / tile_size;
+        for(std::int32_t row = first_row; row <= last_row; row++){
+            for(std::int32_t column = first_column; column <= last_column; column++){
+                bins[row * tiles + column].push_back(entry);
+            }
+        }
+    };
+
+    for(std::uint32_t i = 0; i < segments_.size(); i++){
+        const Segment &s = segments_[i];
+        std::int32_t top = std::max(std::min(s.y0, s.y1), 0);
+        std::int32_t bottom = std::min(std::max(s.y0, s.y1), last_pixel);
+        // Bin a long line row of tiles by row of tiles, using only the part of the line that
+        // crosses each row, widened by a pixel for rounding.
+        for(std::int32_t row = top / tile_size; row <= bottom / tile_size && top <= bottom; row++){
+            std::int32_t x_first = std::min(s.x0, s.x1);
+            std::int32_t x_last = std::max(s.x0, s.x1);
+            if(s.y0 != s.y1){
+                double band_top = std::max(row * tile_size - 1, std::min(s.y0, s.y1));
+                double band_bottom = std::min((row + 1) * tile_size, std::max(s.y0, s.y1));
+                double slope = static_cast<double>(s.x1 - s.x0) / (s.y1 - s.y0);
+                double xa = s.x0 + (band_top - s.y0) * slope;
+                double xb = s.x0 + (band_bottom - s.y0) * slope;
+                auto left = static_cast<std::int32_t>(std::floor(std::min(xa, xb)));
+                auto right = static_cast<std::int32_t>(std::ceil(std::max(xa, xb)));
+                x_first = std::max(x_first, left - 1);
+                x_last = std::min(x_last, right + 1);
+            }
+            bin_rectangle(SEGMENT_ENTRY | i, x_first, row * tile_size, x_last,
+                          row * tile_size + tile_size - 1);
+        }
+    }
+
+    for(std::uint32_t i = 0; i < points_.size(); i++){
+        bin_rectangle(POINT_ENTRY | i, points_[i].x, points_[i].y, points_[i].x, points_[i].y);
+    }
+
+    std::int32_t scale = glyph_scale_();
+    for(std::uint32_t i = 0; i < texts_.size(); i++){
+        const Text &t = texts_[i];
+        std::int32_t width = (t.vertical ? 1 : t.length) * CELL_WIDTH * scale;
+        std::int32_t height = (t.vertical ? t.length : 1) * CELL_HEIGHT * scale;
+        std::int32_t top = t.y - CELL_HEIGHT * scale + 1;
+        bin_rectangle(TEXT_ENTRY | i, t.x, top, t.x + width - 1, top + height - 1);
+    }
+}
+
+void Microfilm::rasterize_tile_(std::uint8_t *pixels, const std::vector<std::uint32_t> &primitives,
+                                std::int32_t left, std::int32_t top) const noexcept{
+    auto size = static_cast<std::int32_t>(resolution_);
+    Tile tile{pixels, size, left, top,
+              std::min(left + static_cast<std::int32_t>(TILE_SIZE), size),
+              std::min(top + static_cast<std::int32_t>(TILE_SIZE), size)};
+    std::int32_t scale = glyph_scale_();
+
+    for(std::uint32_t entry : primitives){
+        std::uint32_t index = entry & ~ENTRY_KIND;
+        switch(entry & ENTRY_KIND){
+            case SEGMENT_ENTRY:{
+                const Segment &s = segments_[index];
+                tile.line(s.x0, s.y0, s.x1, s.y1);
+                break;
+            }
+            case POINT_ENTRY:tile.plot(points_[index].x, points_[index].y);
+                break;
+            default:{
+                const Text &t = texts_[index];
+                for(std::int32_t i = 0; i < t.length; i++){
+                    tile.glyph(text_characters_[t.first + i],
+                               t.vertical ? t.x : t.x + i * CELL_WIDTH * scale,
+                               t.vertical ? t.y + i * CELL_HEIGHT * scale : t.y, scale);
+                }
+                break;
+            }
+        }
+    }
+}
+
+bool Microfilm::render_png_(const std::string &path) const{
+    auto tiles = (resolution_ + TILE_SIZE - 1) / TILE_SIZE;
+    std::vector<std::vector<std::uint32_t>> bins(tiles * tiles);
+    bin_primitives_(bins);
+
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(resolution_) * resolution_, PAPER);
+
+    // Each thread takes the next tile not yet taken until there are none left.
+    std::atomic<unsigned> next_tile{0};
+    auto work = [&](){
+        for(unsigned tile = next_tile++; tile < bins.size(); tile = next_tile++){
+            if(!bins[tile].empty()){
+                rasterize_tile_(pixels.data(), bins[tile],
+                                static_cast<std::int32_t>(tile % tiles * TILE_SIZE),
+                                static_cast<std::int32_t>(tile / tiles * TILE_SIZE));
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    unsigned thread_count = std::min<unsigned>(thread_count_, static_cast<unsigned>(bins.size()));
+    for(unsigned i = 1; i < thread_count; i++){
+        workers.emplace_back(work);
+    }
+    work();
+    for(std::thread &worker : workers){
+        worker.join();
+    }
+
+    std::string png = encode_png(pixels.data(), resolution_, resolution_);
+    return write_file(path, png.data(), png.size());
+}
+
+// endregion: PNG rendering
+
+bool Microfilm::render_svg_(const std::string &path) const{
+    std::string svg;
+    auto out = std::back_inserter(svg);
+    fmt::format_to(out, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"{0}\" height=\"{0}\" "
+                        "viewBox=\"0 0 {0} {0}\">\n<rect width=\"100%\" height=\"100%\" "
+                        "fill=\"white\"/>\n", resolution_);
+
+    // All the lines are one path and all the points another, which keeps large frames compact.
+    if(!segments_.empty()){
+        svg += "<path fill=\"none\" stroke=\"black\" stroke-width=\"1\" "
+               "stroke-linecap=\"square\" d=\"";
+        for(const Segment &s : segments_){
+            fmt::format_to(out, "M{}.5 {}.5L{}.5 {}.5", s.x0, s.y0, s.x1, s.y1);
+        }
+        svg += "\"/>\n";
+    }
+    if(!points_.empty()){
+        svg += "<path fill=\"black\" d=\"";
+        for(const Point &p : points_){
+            fmt::format_to(out, "M{} {}h1v1h-1z", p.x, p.y);
+        }
+        svg += "\"/>\n";
+    }
+
+    std::int32_t scale = glyph_scale_();
+    for(const Text &t : texts_){
+        for(std::int32_t i = 0; i < t.length; i++){
+            char c = text_characters_[t.first + i];
+            const char *escaped = ('<' == c) ? "&lt;" : ('>' == c) ? "&gt;" : ('&' == c) ? "&amp;"
+                                                                                          : nullptr;
+            fmt::format_to(out, "<text x=\"{}\" y=\"{}\" font-family=\"monospace\" "
+                                "font-size=\"{}\">",
+                           t.vertical ? t.x : t.x + i * CELL_WIDTH * scale,
+                           t.vertical ? t.y + i * CELL_HEIGHT * scale : t.y,
+                           CELL_HEIGHT * scale);
+            if(nullptr == escaped){
+                svg.push_back(c);
+            } else{
+                svg += escaped;
+            }
+            svg += "</text>\n";
+        }
+    }
+    svg += "</svg>\n";
+    return write_file(path, svg.data(), svg.size());
+}
+
+} // end namespace elsix
@@ -0,0 +1,156 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The microfilm plotter, which implements the microfilm operations XR, YR, DL, TV, TH, and
+ * `(DO, ADVANC)`.
+ *
+ * The original microfilm recorder exposed each frame of film with a cathode ray tube. Here each
+ * frame is a square image. Drawing operations add lines, points, and text to the display list of
+ * the current frame, and `(DO, ADVANC)` renders the frame to a file and starts the next one.
+ *
+ * A frame is rendered either as an SVG file, written straight from the display list, or as a PNG
+ * image. For PNG the image is divided into square tiles, the primitives are sorted into the tiles
+ * they touch, and a pool of threads renders the tiles independently. A pixel of a line depends
+ * only on the line and not on the tile, so lines are continuous across tile boundaries.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "field.hpp"
+
+namespace elsix{
+
+enum class MicrofilmFormat{
+    PNG,
+    SVG
+};
+
+class Microfilm{
+public:
+    /// The raster of the SC 4020 microfilm recorder.
+    static constexpr unsigned DEFAULT_RESOLUTION = 1024;
+    static constexpr unsigned TILE_SIZE = 64;
+
+    /**
+     * @brief Frames are written to files named by `path_prefix` followed by the four digit frame
+     * number and the extension of the format, as in `frame0001.png`.
+     */
+    Microfilm(std::string path_prefix, MicrofilmFormat format,
+              unsigned resolution = DEFAULT_RESOLUTION);
+
+    /// Implements `(cdxmin, XR, cdxmax)`. Applies to primitives drawn afterward.
+    void set_x_range(Word minimum, Word maximum) noexcept;
+
+    /// Implements `(cdymin, YR, cdymax)`. Applies to primitives drawn afterward.
+    void set_y_range(Word minimum, Word maximum) noexcept;
+
+    /// Implements `(cdx0, DL, cdy0, cdx1, cdy1)`.
+    void draw_line(Word x0, Word y0, Word x1, Word y1);
+
+    /// Implements `(cdx0, DL, cdy0)`.
+    void draw_point(Word x, Word y);
+
+    /**
+     * @brief Implements `(cdx0, TH, cdy0, co, cd)` and `(cdx0, TV, cdy0, co, cd)`: types the low
+     * order `count` characters of `characters`, at most ten. The lower left corner of the first
+     * character is at the point. Horizontal text runs to the right, vertical text downward.
+     */
+    void type(Word x, Word y, Word characters, unsigned count, bool vertical);
+
+    /**
+     * @brief Implements `(DO, ADVANC)`: renders the current frame, then starts an empty one.
+     * @return False if the frame could not be written.
+     */
+    bool advance();
+
+    [[nodiscard]] bool frame_empty() const noexcept{
+        return segments_.empty() && points_.empty() && texts_.empty();
+    }
+
+    /// The number of frames written.
+    [[nodiscard]] unsigned frame_count() const noexcept{
+        return frame_;
+    }
+
+    /// The number of threads rendering PNG frames. Defaults to the number of processors.
+    void set_thread_count(unsigned threads) noexcept{
+        thread_count_ = (0 == threads) ? 1 : threads;
+    }
+
+private:
+    // Primitives are recorded in raster coordinates, with row 0 at the top.
+    struct Segment{
+        std::int32_t x0, y0, x1, y1;
+    };
+    struct Point{
+        std::int32_t x, y;
+    };
+    struct Text{
+        std::int32_t x, y;
+        // The characters, in ASCII, are `text_characters_[first]` onward.
+        std::uint32_t first;
+        std::uint16_t length;
+        bool vertical;
+    };
+
+    std::string path_prefix_;
+    MicrofilmFormat format_;
+    unsigned resolution_;
+    unsigned thread_count_;
+    Word x_minimum_ = 0;
+    Word x_maximum_;
+    Word y_minimum_ = 0;
+    Word y_maximum_;
+    unsigned frame_ = 0;
+
+    // The display list of the current frame.
+    std::vector<Segment> segments_;
+    std::vector<Point> points_;
+    std::vector<Text> texts_;
+    std::string text_characters_;
+
+    [[nodiscard]] std::int32_t to_column_(Word x) const noexcept;
+    [[nodiscard]] std::int32_t to_row_(Word y) const noexcept;
+    /// The size in pixels of a pixel of the character font.
+    [[nodiscard]] std::int32_t glyph_scale_() const noexcept;
+
+    [[nodiscard]] bool render_png_(const std::string &path) const;
+    [[nodiscard]] bool render_svg_(const std::string &path) const;
+    void rasterize_tile_(std::uint8_t *pixels, const std::vector<std::uint32_t> &primitives,
+                         std::int32_t left, std::int32_t top) const noexcept;
+    void bin_primitives_(std::vector<std::vector<std::uint32_t>> &bins) const;
+};
+
+} // end namespace elsix
@@ -110,6 +110,7 @@ enum class NodeType: uint_fast8_t{
         SETUP_STORAGE,
     DEFINE_FIELD,
     GET_BLOCK,
+    GET_CHAIN,
     FREE_BLOCK,
     SET_EQUAL,
     COPY_FIELD = SET_EQUAL,
@@ -212,6 +213,7 @@ enum class ArgType: uint_fast8_t{
 #define LPAREN_TOKEN '('
 #define RPAREN_TOKEN ')'
 #define COMMA_TOKEN ','
+#define STAR_TOKEN '*'    // Starts an octal number literal.
 #define COMMENT_TOKEN ';' // No ASTNode or NodeType.
 
 } // end namespace elsix
@@ -41,6 +41,7 @@
 #include "astnode.hpp"
 #include "nodetypes.hpp"
 #include "reservedwords.hpp"
+#include "charset.hpp"
 
 namespace elsix{
 
@@ -57,26 +58,30 @@ parser::parser(TokenStream &&token_stream, ErrorHandler &&error_handler) : token
 }
 // endregion: Parser constructors.
 
+const ErrorHandler &parser::error_handler() const noexcept{
+    return *error_handler_;
+}
+
 /**
  * @brief PROGRAM = LINE ('\n' LINE)*
  * @return The root node of the program.
  */
 ASTNode_sp parser::parse(){
     ASTNode_sp root_node{
-        std::make_shared<ASTNode>(NodeType::PROGRAM)
+        std::make_shared<ASTNode>(NodeType::PROGRAM, token_stream_.peek()->span.start)
     };
-    ASTNode_sp next_node{parse_line()};
-    root_node->span.start = root_node->children.back()->span.end;
     
-    while(next_node->type != NodeType::EOF_
-        // ToDo: Should we stop on `NoteType::ERROR`? Perhaps distinguish error categories.
-        && next_node->type != NodeType::ERROR){
-        // Parse the line.
-        attachChild(std::move(next_node), root_node);
-        next_node = parse_line();
+    while(NodeType::EOF_ != token_stream_.peek()->type){
+        ASTNode_sp line_node{parse_line()};
+        // Blank lines and lines holding only a comment leave no line behind.
+        if(!line_node->children.empty()){
+            attachChild(std::move(line_node), root_node);
+        }
     }
     
-    root_node->span.end = root_node->children.back()->span.end;
+    if(!root_node->children.empty()){
+        root_node->span.end = root_node->children.back()->span.end;
+    }
     return root_node;
 }
 
@@ -86,15 +91,14 @@ ASTNode_sp parser::parse(){
  */
 ASTNode_sp parser::parse_line(){
     ASTNode *token{token_stream_.peek()};
-    NodeType next_token_type = token->type;
     ASTNode_sp line_node{
         // All non leaf nodes initially have a zero length span, as they may not have any children.
         std::make_shared<ASTNode>(NodeType::LINE, token->span.start)
     };
     
-    while(NodeType::EOL != next_token_type && NodeType::ERROR != next_token_type){
+    while(NodeType::EOL != token->type && NodeType::EOF_ != token->type){
         // Alphabetic characters signal either a label or a keyword.
-        switch(next_token_type){
+        switch(token->type){
             case NodeType::HOLLERITH_LITERAL:{
                 ASTNode_sp child = attachChild(parse_label_or_keyword(), line_node);
                 if(child->type == NodeType::LABEL){
@@ -103,7 +107,7 @@ ASTNode_sp parser::parse_line(){
                         error_handler_->emitError(
                             fmt::format(
                                 "Not a keyword, and a line can only have one label: {}",
-                                *std::get<const std::string *>(child->value)), child->span
+                                child->value_as_string()), child->span
                         );
                     } else{
                         // Labeled line. Record the label of this line node in the labels table.
@@ -124,19 +128,23 @@ ASTNode_sp parser::parse_line(){
                 break;
             }
             default:{
-                // Unexpected token.
+                // Unexpected token. Skip it so that the rest of the line can still be checked.
                 error_handler_->emitError(
-                    fmt::format(
-                        "Unexpected token: {}", token_stream_.span_to_string(token->span)),
-                    token->span
+                    fmt::format("Unexpected token: {}", token_text(*token)), token->span
                 );
+                token_stream_.next();
             }
         } // End switch NodeType.
         token = token_stream_.peek();
     } // End while
     
+    // Consume the end of the line.
+    if(NodeType::EOL == token->type){
+        token_stream_.next();
+    }
+    
     if(!line_node->children.empty()){
-        line_node->span.end = line_node->children.end()->get()->span.end;
+        line_node->span.end = line_node->children.back()->span.end;
     }
     
     return line_node;
@@ -146,27 +154,28 @@ ASTNode_sp parser::parse_label_or_keyword(){
     ASTNode *next_token{token_stream_.peek()};
     
     // Determine if the token is a keyword or label.
-    auto found = lookup_keyword(next_token->value_as_string());
-    if(found == NodeType::EMPTY){
-        // The token is a label.
-        next_token->type = NodeType::LABEL;
-    } else{
-        // Keyword.
-        next_token->type = found;
-        switch(found){
-            case NodeType::IFANY:[[fallthrough]];
-            case NodeType::IFALL:[[fallthrough]];
-            case NodeType::IFNALL:[[fallthrough]];
-            case NodeType::IFNONE:
-                // Note: `parse_if()` must call token_stream_.next().
-                return parse_if();
-            case NodeType::THEN:
-                // Note: `parse_then()` must call token_stream_.next().
-                return parse_then();
-            case NodeType::DONE:return token_stream_.next();
-            default:UNREACHABLE
-        } // End switch on token type
-    } // End keyword not found.
+    NodeType found = lookup_keyword(next_token->value_as_string());
+    switch(found){
+        case NodeType::EMPTY:
+            // The token is a label.
+            next_token->type = NodeType::LABEL;
+            break;
+        case NodeType::IFANY:[[fallthrough]];
+        case NodeType::IFALL:[[fallthrough]];
+        case NodeType::IFNALL:[[fallthrough]];
+        case NodeType::IFNONE:
+            next_token->type = found;
+            // Note: `parse_if()` must call token_stream_.next().
+            return parse_if();
+        case NodeType::THEN:
+            // Note: `parse_then()` must call token_stream_.next().
+            return parse_then();
+        case NodeType::DONE:[[fallthrough]];
+        case NodeType::FAIL:
+            next_token->type = found;
+            break;
+        default:UNREACHABLE
+    } // End switch on token type
     
     return token_stream_.next();
 }
@@ -191,6 +200,7 @@ ASTNode_sp parser::parse_if(){
     { // Scope of `if_token`.
         ASTNode_sp if_token{token_stream_.next()};
         if_expr->span.start = if_token->span.start;
+        if_expr->span.end = if_token->span.end;
         if_expr->type = if_token->type;
     }
     
@@ -217,7 +227,9 @@ ASTNode_sp parser::parse_if(){
     }
     
     // Record the end location of the statement.
-    if_expr->span.end = if_expr->children.back()->span.end;
+    if(!if_expr->children.empty()){
+        if_expr->span.end = if_expr->children.back()->span.end;
+    }
     
     return if_expr;
 }
@@ -235,21 +247,13 @@ ASTNode_sp parser::parse_if(){
  */
 ASTNode_sp parser::parse_then(){
     ASTNode *next_token{token_stream_.peek()};
-    ASTNode_sp then_expr{std::make_shared<ASTNode>(NodeType::THEN)};
-    
-    // Record the start of the THEN expression.
-    then_expr->span.start = next_token->span.start;
+    ASTNode_sp then_expr{std::make_shared<ASTNode>(NodeType::THEN, next_token->span)};
     
-    if(NodeType::HOLLERITH_LITERAL == next_token->type){
-        std::string_view text{next_token->value_as_string()};
-        if("THEN" == text){
-            // Consume the keyword, as we never refer to it in isolation.
-            token_stream_.next();
-            next_token = token_stream_.peek();
-        }
-    } else{
-        // Error.
-        error_handler_->emitError("THEN keyword expected here.", next_token->span);
+    // The keyword is optional on a line that starts with an operation. Consume it, as we never
+    // refer to it in isolation.
+    if(NodeType::HOLLERITH_LITERAL == next_token->type && "THEN" == next_token->value_as_string()){
+        token_stream_.next();
+        next_token = token_stream_.peek();
     }
     
     // THEN may be followed by zero or more operations.
@@ -263,13 +267,13 @@ ASTNode_sp parser::parse_then(){
         attachChild(parse_goto(), then_expr);
     }
     
-    // Record the end location of the statement.
-    then_expr->span.end = then_expr->children.back()->span.end;
-    
     // Check for an empty THEN, which is an error. The goto is mandatory if
     // there are no operations.
     if(then_expr->children.empty()){
         error_handler_->emitError("A THEN statement cannot be empty.", then_expr->span);
+    } else{
+        // Record the end location of the statement.
+        then_expr->span.end = then_expr->children.back()->span.end;
     }
     
     return then_expr;
@@ -283,79 +287,38 @@ ASTNode_sp parser::parse_then(){
  * @return A node representing the test.
  */
 ASTNode_sp parser::parse_test(){
-    const std::string *op_code;
-    OperationData *op_info;
+    Location start{token_stream_.peek()->span.start};
     // There are exactly three terms to every test.
-    ASTNode_sp arg1;
-    ASTNode_sp op;
-    ASTNode_sp arg2;
-    // Consume '(', which should be the next character.
-    expect(NodeType::LPAREN);
-    
-    arg1 = token_stream_.next();
-    check_node_type(*arg1, NodeType::HOLLERITH_LITERAL);
-    arg1->type = NodeType::CONTENTS_LITERAL;
-    
-    expect(NodeType::COMMA);
+    Location end;
+    std::vector<ASTNode_sp> items;
+    if(!parse_items(items, end)){
+        return error_node(Span(start, end));
+    }
+    Span span{start, end};
     
-    op = token_stream_.next();
-    arg1 = attachChild(std::move(arg1), op);
-    check_node_type(*op, NodeType::HOLLERITH_LITERAL);
-    op_info = lookup_op(op->value_as_string(), tests);
+    const OperationData *op_info = nullptr;
+    if(3 == items.size() && NodeType::HOLLERITH_LITERAL == items[1]->type){
+        op_info = lookup_op(items[1]->value_as_string(), tests);
+    }
     if(nullptr == op_info){
         // Oops, not a test operator.
         error_handler_->emitError(
             fmt::format(
-                "Only tests are allowed here, but {} is not a test.", op->value_as_string()),
-            op->span
+                "Only tests are allowed here, but '{}' is not a test.",
+                token_stream_.span_to_string(span)),
+            span
         );
-        // ToDo(Robert): Return from the function in a sensible way, making sure the next use of
-        //  op_info is not on an uninitialized pointer.
+        return error_node(span);
     }
-    op->type = op_info->type;
-    
-    expect(NodeType::COMMA);
-    
-    arg2 = token_stream_.next();
-    arg2 = attachChild(std::move(arg2), op);
     
+    ASTNode_sp op = items[1];
+    op->type = op_info->type;
+    op->span = span;
     // Parse the number literals.
-    switch(op_info->arg_types[1]){
-        case ArgType::D: //Decimal
-            check_node_type(*arg2, NodeType::NUMBER_LITERAL);
-            interpret_as_number(arg2);
-            break;
-        case ArgType::O:check_node_type(*arg2, NodeType::NUMBER_LITERAL);
-            interpret_as_number(arg2, 8);
-            break;
-        case ArgType::C:arg2->type = NodeType::CONTENTS_LITERAL;
-            break;
-        case ArgType::CD:
-            if(NodeType::NUMBER_LITERAL == arg2->type){
-                interpret_as_number(arg2);
-            } else{
-                arg2->type = NodeType::CONTENTS_LITERAL;
-            }
-            break;
-        case ArgType::CO:
-            if(NodeType::NUMBER_LITERAL == arg2->type){
-                interpret_as_number(arg2, 8);
-            } else{
-                arg2->type = NodeType::CONTENTS_LITERAL;
-            }
-            break;
-        case ArgType::H:arg2->type = NodeType::NUMBER_LITERAL;
-            error_handler_->emitError(
-                "Hollerith literals are not implemented here.", op->span
-            );
-            // ToDo(Robert): Write a conversion function from "Hollerith" literals to numbers.
-            //  The character set needs to be selectable.
-            break;
-        default:UNREACHABLE;
-    }
-    
-    // Consume ')', which should be the next character.
-    expect(NodeType::RPAREN);
+    interpret_as_type(items[0], op_info->arg_types[0]);
+    interpret_as_type(items[2], op_info->arg_types[1]);
+    attachChild(std::move(items[0]), op);
+    attachChild(std::move(items[2]), op);
     
     return op;
 }
@@ -397,141 +360,195 @@ ASTNode_sp parser::parse_goto(ASTNode_sp label){
  * @return
  */
 ASTNode_sp parser::parse_operation(){
-    // std::string_view op_code;
-    // There can be up to 5 arguments.
-    std::array<ASTNode_sp, 5> args;
-    int argi = 0;
-    ASTNode_sp delimiter;
-    ASTNode_sp operation;
     // Because we re-use the op code token node as the operation node, and because the op code token
     // node is never the first token (except for `DO`), we must record the start of the operation
     // expression.
     Location start{token_stream_.peek()->span.start};
-    Location end;
     
-    // Consume '(', which should be the next character.
-    expect(NodeType::LPAREN);
-    
-    // We gather up all the tokens first, because the number of expressions in the operation helps
+    // We gather up all the items first, because the number of items in the operation helps
     // determine which operation it is.
-    for(argi = 0; argi < 5; argi++){
-        args[argi] = token_stream_.next();
-        delimiter = token_stream_.next();
-        if(NodeType::RPAREN == delimiter->type){
-            // Record the end of the operation, which necessarily must be the closing ')'.
-            end = delimiter->span.end;
-            break;
-        }
-        if(NodeType::EOL == delimiter->type){
-            // Error, we reached the end of the line without reaching an `)`.
-            // Record the end of the operation, which is also the location of the error.
-            end = delimiter->span.end;
-            break;
-        }
-        check_node_type(*delimiter, NodeType::COMMA);
+    Location end;
+    std::vector<ASTNode_sp> items;
+    if(!parse_items(items, end)){
+        return error_node(Span(start, end));
     }
+    Span span{start, end};
     
-    // We create a bespoke decision tree since there are only 5 cases.
-    switch(argi){
-        
-        // region: Special Cases
-        
-        case 0:
-            // Empty or singleton operator. This is always an error.
-            error_handler_->emitError(
-                fmt::format("Operator cannot be empty: {}.", delimiter->value_as_string()),
-                delimiter->span
-            );
-            // TODO: Set operation to error node.
-            break;
-        case 1:
-            // Two items: `(DO label)` and the two argument form of `(c, P, d)`.
-            if(args[0]->type == NodeType::HOLLERITH_LITERAL && "DO" == args[0]->value_as_string()){
-                // DO
+    ASTNode_sp operation;
+    bool found = false;
+    std::string_view op_code;
+    if(items.size() > 2 && NodeType::HOLLERITH_LITERAL == items[1]->type){
+        op_code = items[1]->value_as_string();
+    }
+    
+    // We create a bespoke decision tree since there are only 4 cases.
+    switch(items.size()){
+        case 2:
+            // Two items: `(DO, s)` and the abbreviation `(a, Δ)` of `(a, P, aΔ)`.
+            found = true;
+            if(NodeType::HOLLERITH_LITERAL == items[0]->type
+               && "DO" == items[0]->value_as_string()){
                 operation = std::make_shared<ASTNode>(NodeType::DO);
-                attachChild(parse_goto(args[1]), operation);
+                attachChild(parse_goto(items[1]), operation);
             } else{
-                // There is only one other two-argument operator: the two argument form of (c, P, d).
-                // In this abbreviated form, the second argument is a decimal literal.
                 operation = std::make_shared<ASTNode>(NodeType::POINT_TO_SAME_AS);
-                args[0]->type = NodeType::CONTENTS_LITERAL;
-                // The second argument should have already been identified as a number literal.
-                check_node_type(*args[1], NodeType::NUMBER_LITERAL);
-                interpret_as_number(args[1]);
-                attachChild(std::move(args[0]), operation);
-                attachChild(std::move(args[1]), operation);
+                interpret_as_contents(items[0]);
+                // The second item names the field to advance through.
+                interpret_as_type(items[1], ArgType::FIELD_NAME);
+                attachChild(std::move(items[0]), operation);
+                attachChild(std::move(items[1]), operation);
             }
             break;
-        case 2:
-            { // Scope of `op_code` and `operation`.
+        case 3:
             // Three items. The most common case.
-            operation = args[1];
-            std::string_view op_code(operation->value_as_string());
-            
-            // We handle the handful of special cases first: `FR`, `FC`, and `FD` are overloaded.
-            if("FR" == op_code){
-                // Free block
-                args[0]->type = NodeType::CONTENTS_LITERAL;
-                // TODO: Validate that args[0] really is NodeType::CONTENTS_LITERAL rather than,
-                //  say, NodeType::LPAREN or NodeType::COMMA.
-                operation->type = NodeType::FREE_BLOCK;
-                if("0" == args[2]->value_as_string()){
-                    // Zero is the only number literal possible.
-                    args[2]->value = 0UL;
-                    args[2]->type = NodeType::NUMBER_LITERAL;
-                } else{
-                    args[2]->type = NodeType::CONTENTS_LITERAL;
-                }
-                attachChild(std::move(args[0]), operation);
-                attachChild(std::move(args[2]), operation);
-                
-            } else if("FC" == op_code){
+            operation = items[1];
+            // We handle the handful of special cases first: `FC` and `FD` are overloaded, and
+            // `(s2, DO, s)` names a line instead of contents.
+            if("FC" == op_code){
                 // Save/Restore Field Contents
                 //Nearly identical to `FD`, so we factor out code to method.
-                parse_save_restore(operation, args[0], args[2], NodeType::SAVE_FIELD_CONTENTS,
-                    NodeType::RESTORE_FIELD_CONTENTS);
-                break;
+                found = true;
+                parse_save_restore(operation, items[0], items[2], NodeType::SAVE_FIELD_CONTENTS,
+                                   NodeType::RESTORE_FIELD_CONTENTS);
             } else if("FD" == op_code){
                 // Save/Restore Field Definition
-                parse_save_restore(operation, args[0], args[2], NodeType::SAVE_FIELD_DEFINITION,
+                found = true;
+                parse_save_restore(operation, items[0], items[2],
+                                   NodeType::SAVE_FIELD_DEFINITION,
                                    NodeType::RESTORE_FIELD_DEFINITION);
-                break;
+            } else if("DO" == op_code){
+                found = true;
+                operation->type = NodeType::DO_OR_FAIL;
+                interpret_as_type(items[0], ArgType::S);
+                attachChild(std::move(items[0]), operation);
+                attachChild(parse_goto(items[2]), operation);
+            } else{
+                found = interpret_operation(items, op_code, binary_operators);
             }
-            
-            // Look for op in operators map.
-            auto op_info = lookup_op(op_code, operators);
-            if(nullptr != op_info){
-                operation->type = op_info->type;
-                // Parse arguments according to `op_info` spec.
-                for(int i = 0; i < 4; i++){
-                    auto arg_type = op_info->arg_types[i];
-                    
-                }
+            break;
+        case 4:
+            operation = items[1];
+            // `(w, Df, b1, b2)` defines the field `f`, which the lowering reads from the op code.
+            if(2 == op_code.size() && 'D' == op_code[0]){
+                found = interpret_operation(items, op_code.substr(0, 1), ternary_operators);
             } else{
-                // Not in operators map. Check for a special case.
-                // Unknown operation.
-                Span error_span{start, end};
-                error_handler_->emitError(
-                    fmt::format(
-                        "Cannot interpret the operation '{}'. Check your spelling and make sure "
-                        "you are supplying the right number of arguments.",
-                        token_stream_.span_to_string(error_span)
-                        ),
-                        error_span
-                );
-                // ToDo: Set operation to an error node.
+                found = interpret_operation(items, op_code, ternary_operators);
             }
-        }
-        
+            break;
+        case 5:
+            operation = items[1];
+            found = interpret_operation(items, op_code, quaternary_operators);
+            break;
+        default:
+            break;
+    }
+    
+    if(!found){
+        // Unknown operation.
+        error_handler_->emitError(
+            fmt::format(
+                "Cannot interpret the operation '{}'. Check your spelling and make sure "
+                "you are supplying the right number of arguments.",
+                token_stream_.span_to_string(span)
+            ),
+            span
+        );
+        return error_node(span);
     }
     
     // Record the start and end location of the statement.
-    operation->span.start = start;
-    operation->span.end = end;
+    operation->span = span;
     
     return operation;
 }
 
+/**
+ * @brief Gathers the items of a parenthesized list, `(a, b, ...)`, consuming the parentheses.
+ *
+ * An empty item is a blank, as in `(X1, EH, )`. On an error, the rest of the list is skipped.
+ * `end` is set to the end of the list, or to where the error is.
+ *
+ * @return Whether the list was well formed.
+ */
+bool parser::parse_items(std::vector<ASTNode_sp> &items, Location &end){
+    expect(NodeType::LPAREN);
+    while(true){
+        ASTNode *next_token{token_stream_.peek()};
+        end = next_token->span.start;
+        switch(next_token->type){
+            case NodeType::COMMA:[[fallthrough]];
+            case NodeType::RPAREN:{
+                ASTNode_sp blank{
+                    std::make_shared<ASTNode>(NodeType::HOLLERITH_LITERAL, next_token->span.start)
+                };
+                blank->value = std::string_view(" ");
+                items.push_back(std::move(blank));
+                break;
+            }
+            case NodeType::NUMBER_LITERAL:[[fallthrough]];
+            case NodeType::HOLLERITH_LITERAL:[[fallthrough]];
+            case NodeType::T_DOT:[[fallthrough]];
+            case NodeType::N_DOT:items.push_back(token_stream_.next());
+                break;
+            default:
+                error_handler_->emitError(
+                    fmt::format("Unexpected {} in a list.", token_text(*next_token)),
+                    next_token->span
+                );
+                skip_list();
+                return false;
+        }
+        
+        ASTNode *delimiter{token_stream_.peek()};
+        if(NodeType::RPAREN == delimiter->type){
+            end = token_stream_.next()->span.end;
+            return true;
+        }
+        if(NodeType::COMMA != delimiter->type){
+            check_node_type(*delimiter, NodeType::COMMA);
+            skip_list();
+            return false;
+        }
+        token_stream_.next();
+    }
+}
+
+/// Skips the rest of a list that has an error, up to and including its `)` but not past the end of
+/// the line.
+void parser::skip_list(){
+    for(ASTNode *token = token_stream_.peek();
+        NodeType::EOL != token->type && NodeType::EOF_ != token->type;
+        token = token_stream_.peek()){
+        if(NodeType::RPAREN == token_stream_.next()->type){
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Types the items of `(a, op, b, ...)` by the entry for `op_code` in `map`, the database
+ * for their number, and attaches them to the op code node, which becomes the operation node.
+ *
+ * @return Whether `op_code` is in the database.
+ */
+bool parser::interpret_operation(std::vector<ASTNode_sp> &items, std::string_view op_code,
+                                 const OperatorMap &map){
+    const OperationData *op_info = lookup_op(op_code, map);
+    if(nullptr == op_info){
+        return false;
+    }
+    ASTNode_sp &operation = items[1];
+    operation->type = op_info->type;
+    // Parse arguments according to `op_info` spec.
+    // The op code is the second item, so argument `i` is item `i + 1` after the first.
+    for(std::size_t i = 0; i + 1 < items.size(); i++){
+        ASTNode_sp &arg = items[0 == i ? 0 : i + 1];
+        interpret_as_type(arg, op_info->arg_types[i]);
+        attachChild(std::move(arg), operation);
+    }
+    return true;
+}
+
 ASTNode_sp parser::parse_save_restore(ASTNode_sp operation, ASTNode_sp arg0, ASTNode_sp arg2,
     NodeType save_node_type, NodeType restore_node_type)
 const{
@@ -555,18 +572,48 @@ const{
     return operation;
 }
 
+/// A node standing for a statement that could not be parsed, so that parsing can go on.
+ASTNode_sp parser::error_node(Span span){
+    return std::make_shared<ASTNode>(NodeType::ERROR, span);
+}
+
+/// The text of a token for an error message.
+std::string parser::token_text(const ASTNode &token) const{
+    switch(token.type){
+        case NodeType::EOL:return "the end of the line";
+        case NodeType::EOF_:return "the end of the file";
+        default:return fmt::format("'{}'", token_stream_.span_to_string(token.span));
+    }
+}
+
 void parser::check_node_type(const ASTNode &node, NodeType expected){
-    if(node.type != expected){
-        error_handler_->emitError(
-            fmt::format("Expected {}, but got {}.", "expected", "node.type"), node.span
-        );
+    if(node.type == expected){
+        return;
+    }
+    std::string_view wanted;
+    switch(expected){
+        case NodeType::LPAREN:wanted = "'('";
+            break;
+        case NodeType::RPAREN:wanted = "')'";
+            break;
+        case NodeType::COMMA:wanted = "','";
+            break;
+        default:wanted = "a name";
+            break;
     }
+    error_handler_->emitError(
+        fmt::format("Expected {}, but got {}.", wanted, token_text(node)), node.span
+    );
 }
 
+/// Consumes the next token if it is of the `expected` type, and complains if it is not.
 void parser::expect(NodeType expected){
-    check_node_type(*token_stream_.peek(), expected);
+    ASTNode *next_token{token_stream_.peek()};
+    check_node_type(*next_token, expected);
+    if(next_token->type == expected){
+        token_stream_.next();
+    }
 }
-
 /**
  * @brief Safe conversion of the value of the node from a pointer to a string representation of
  * a number in `base` to an unsigned long.
@@ -587,11 +634,11 @@ void parser::interpret_as_type(ASTNode_sp &node, ArgType type){
             if(NodeType::NUMBER_LITERAL == node->type){
                 interpret_as_number(node);
             } else{
-                node->type = NodeType::CONTENTS_LITERAL;
+                interpret_as_contents(node);
             }
             break;
         
-        case ArgType::C:node->type = NodeType::CONTENTS_LITERAL;
+        case ArgType::C:interpret_as_contents(node);
             break;
         
         case ArgType::D:interpret_as_number(node);
@@ -600,16 +647,14 @@ void parser::interpret_as_type(ASTNode_sp &node, ArgType type){
         case ArgType::O:interpret_as_number(node, 8);
             break;
         
-        case ArgType::H:
-            // The node type *should* already be Hollerith, but just in case.
-            node->type = NodeType::HOLLERITH_LITERAL;
+        case ArgType::H:interpret_as_hollerith(node);
             break;
         
         case ArgType::CO:
             if(NodeType::NUMBER_LITERAL == node->type){
                 interpret_as_number(node, 8);
             } else{
-                node->type = NodeType::CONTENTS_LITERAL;
+                interpret_as_contents(node);
             }
             break;
         
@@ -646,6 +691,46 @@ void parser::interpret_as_type(ASTNode_sp &node, ArgType type){
     
 }
 
+/**
+ * @brief Conversion of the value of the node from the text of a Hollerith literal to the number
+ * whose six bit characters spell it, in the character set Elsix was built with.
+ *
+ * @param node
+ */
+void parser::interpret_as_hollerith(ASTNode_sp &node){
+    std::string_view sv = node->value_as_string();
+    
+    if(sv.size() > CHARACTERS_PER_WORD){
+        error_handler_->emitError(
+            fmt::format(
+                "Hollerith literal '{}' is longer than {} characters.", sv, CHARACTERS_PER_WORD
+            ), node->span
+        );
+        node->type = NodeType::ERROR;
+        return;
+    }
+    
+    node->value = static_cast<unsigned long>(encode_hollerith(sv));
+    node->type = NodeType::NUMBER_LITERAL;
+}
+
+/**
+ * @brief Marks the node as naming contents. `T.` and `n.` can be read wherever contents can, so
+ * they keep their own types. The value of `n.` becomes the order `n`.
+ *
+ * @param node
+ */
+void parser::interpret_as_contents(ASTNode_sp &node){
+    if(NodeType::N_DOT == node->type){
+        interpret_as_number(node);
+        if(NodeType::ERROR != node->type){
+            node->type = NodeType::N_DOT;
+        }
+    } else if(NodeType::T_DOT != node->type){
+        node->type = NodeType::CONTENTS_LITERAL;
+    }
+}
+
 /**
  * @brief Safe conversion of the value of the node from a pointer to a string representation of
  * a decimal number to an unsigned long.
@@ -656,10 +741,18 @@ void parser::interpret_as_number(ASTNode_sp &node, int base){
     std::string_view sv = node->value_as_string();
     unsigned long long_value = 0UL;
     
-    // Attempt to convert the number.
-    auto result = std::from_chars(sv.data(), sv.data() + sv.size(), long_value);
+    // A leading `*` makes a number octal wherever it is written.
+    if(!sv.empty() && STAR_TOKEN == sv.front()){
+        sv.remove_prefix(1);
+        base = 8;
+    }
+    
+    // Attempt to convert the number. Only `n.` has anything after its digits.
+    auto result = std::from_chars(sv.data(), sv.data() + sv.size(), long_value, base);
+    bool rest_ok = result.ptr == sv.data() + sv.size()
+                   || (NodeType::N_DOT == node->type && '.' == *result.ptr);
     
-    if(result.ec == std::errc::invalid_argument){
+    if(result.ec != std::errc() || !rest_ok){
         error_handler_->emitError(
             fmt::format("Invalid argument: '{}'. Expected a literal number.", sv), node->span
         );
@@ -36,6 +36,7 @@
 #include "astnode.hpp"
 #include "nodetypes.hpp"
 #include "tokenstream.hpp"
+#include "reservedwords.hpp"
 
 namespace elsix{
 
@@ -50,6 +51,8 @@ public:
     ~parser() = default;
     
     ASTNode_sp parse();
+    /// The handler the errors found by `parse()` were reported to.
+    [[nodiscard]] const ErrorHandler &error_handler() const noexcept;
 
 private:
     TokenStream &token_stream_;
@@ -68,12 +71,22 @@ private:
     [[nodiscard]] ASTNode_sp parse_goto();
     [[nodiscard]] ASTNode_sp parse_goto(ASTNode_sp label);
     [[nodiscard]] ASTNode_sp parse_operation();
+    [[nodiscard]] bool parse_items(std::vector<ASTNode_sp> &items, Location &end);
+    void skip_list();
+    bool interpret_operation(std::vector<ASTNode_sp> &items, std::string_view op_code,
+                             const OperatorMap &map);
+    ASTNode_sp parse_save_restore(ASTNode_sp operation, ASTNode_sp arg0, ASTNode_sp arg2,
+                                  NodeType save_node_type, NodeType restore_node_type) const;
     
     // Utility functions.
+    [[nodiscard]] static ASTNode_sp error_node(Span span);
+    [[nodiscard]] std::string token_text(const ASTNode &token) const;
     void check_node_type(const ASTNode &node, NodeType expected);
     void expect(NodeType expected);
     void interpret_as_type(ASTNode_sp &node, ArgType type);
     void interpret_as_number(ASTNode_sp &node, int base = 10);
+    void interpret_as_hollerith(ASTNode_sp &node);
+    void interpret_as_contents(ASTNode_sp &node);
     
 };
 
@@ -0,0 +1,120 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include "printlist.hpp"
+#include "conversion.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// Words printed on each line after the address.
+constexpr unsigned WORDS_PER_LINE = 5;
+
+/// A word is 22 octal digits: two for its high four bits and ten for each thirty bits below.
+void print_octal_word(CardWriter &printer, Word word){
+    printer.write(DEFAULT_CHARACTERS.blank, 1);
+    printer.write(binary_to_octal(word >> 60), 2);
+    printer.write(binary_to_octal(word >> 30), CONVERSION_DIGITS);
+    printer.write(binary_to_octal(word), CONVERSION_DIGITS);
+}
+
+void print_block(CardWriter &printer, Word address, const Word *block, unsigned words){
+    printer.write(binary_to_octal(address), CONVERSION_DIGITS);
+    for(unsigned i = 0; i < words; i++){
+        if(0 != i && 0 == i % WORDS_PER_LINE){
+            // Indent continuation lines past the address.
+            printer.end_line();
+            printer.write(broadcast(DEFAULT_CHARACTERS.blank), CONVERSION_DIGITS);
+        }
+        print_octal_word(printer, block[i]);
+    }
+    printer.end_line();
+}
+
+} // end anonymous namespace
+
+PrintListResult print_list(const StorageManager &storage, CardWriter &printer, Word first,
+                           const FieldDefinition &link, unsigned words, bool detect_cycles){
+    // Start the prefetching cursor off ahead of the printing cursor. It stops at the end of the
+    // list; in a cycle it simply goes around.
+    Word ahead = first;
+    for(unsigned i = 0; i < PRINT_LIST_PREFETCH_DISTANCE && storage.is_block(ahead); i++){
+        const Word *block = storage.resolve(ahead);
+        __builtin_prefetch(block);
+        ahead = link.load(block);
+    }
+
+    // Brent's algorithm: the tortoise waits at a block while the list is walked a power of two
+    // more blocks, then jumps to the current block. Meeting it again means a cycle.
+    Word tortoise = first;
+    std::size_t power = 1;
+    std::size_t steps = 0;
+
+    std::size_t blocks = 0;
+    Word current = first;
+    while(true){
+        if(0 == current){
+            return {blocks, ListEnd::NULL_LINK};
+        }
+        if(!storage.is_block(current)){
+            return {blocks, ListEnd::NOT_A_BLOCK};
+        }
+
+        if(storage.is_block(ahead)){
+            const Word *block = storage.resolve(ahead);
+            ahead = link.load(block);
+            if(storage.is_block(ahead)){
+                __builtin_prefetch(storage.resolve(ahead));
+            }
+        }
+
+        const Word *block = storage.resolve(current);
+        unsigned block_words = 1U << storage.order_of(current);
+        print_block(printer, current, block,
+                    (PRINT_WHOLE_BLOCK == words || words > block_words) ? block_words : words);
+        blocks++;
+
+        Word next = link.load(block);
+        if(detect_cycles){
+            if(next == tortoise){
+                return {blocks, ListEnd::CYCLE};
+            }
+            if(++steps == power){
+                tortoise = next;
+                power *= 2;
+                steps = 0;
+            }
+        }
+        current = next;
+    }
+}
+
+} // end namespace elsix
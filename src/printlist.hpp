@@ -0,0 +1,81 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Print List, which prints every block of a list.
+ *
+ * The list is walked natively rather than by interpreting a loop. Walking a long list is
+ * dominated by cache misses on the blocks, so a second cursor runs several blocks ahead of the
+ * one being printed, prefetching each block it reaches. By the time a block is printed it is
+ * usually in the cache.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "field.hpp"
+#include "storage.hpp"
+#include "cardio.hpp"
+
+namespace elsix{
+
+/// How many blocks ahead of the block being printed are prefetched.
+constexpr unsigned PRINT_LIST_PREFETCH_DISTANCE = 8;
+
+/// Print every word of each block.
+constexpr unsigned PRINT_WHOLE_BLOCK = 0;
+
+/// Why Print List stopped.
+enum class ListEnd{
+    NULL_LINK,      // The last block's link was zero: the normal end of a list.
+    NOT_A_BLOCK,    // A link was not the address of an allocated block.
+    CYCLE           // The list led back on itself. Only detected if asked for.
+};
+
+struct PrintListResult{
+    std::size_t blocks;
+    ListEnd end;
+};
+
+/**
+ * @brief Implements `(c, PL, f)` and `(c, PL, f, cd)`: prints the blocks of the list that begins
+ * with the block at `first` and is linked through the field `link`.
+ *
+ * Each block is printed in octal as its address followed by its first `words` words, or all of
+ * its words if `words` is `PRINT_WHOLE_BLOCK`. The list ends at a zero link or at a link that is
+ * not a block. With `detect_cycles`, Brent's algorithm also stops a list that loops back on
+ * itself, at the cost of a comparison per block, after printing at most a few blocks twice.
+ */
+PrintListResult print_list(const StorageManager &storage, CardWriter &printer, Word first,
+                           const FieldDefinition &link, unsigned words = PRINT_WHOLE_BLOCK,
+                           bool detect_cycles = false);
+
+} // end namespace elsix
@@ -0,0 +1,85 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include "program.hpp"
+
+namespace elsix{
+
+std::uint32_t Program::find_label(std::string_view label) const noexcept{
+    for(std::uint32_t i = 0; i < lines.size(); i++){
+        if(NO_INDEX != lines[i].label && this->label(lines[i]) == label){
+            return i;
+        }
+    }
+    return NO_INDEX;
+}
+
+std::string Program::operand_name(const Operand &operand) const{
+    switch(operand.kind){
+        case OperandKind::NONE:
+            return std::string();
+        case OperandKind::LITERAL:
+            return std::to_string(operand.value);
+        case OperandKind::CLOCK:
+            return "T.";
+        case OperandKind::AVAILABLE:
+            return std::to_string(operand.value) + ".";
+        case OperandKind::BUG:
+        case OperandKind::FIELD:{
+            std::string name(1, static_cast<char>('A' + operand.bug));
+            for(unsigned i = 0; i < operand.length; i++){
+                name += field_name(paths[operand.path + i]);
+            }
+            return name;
+        }
+    }
+    return std::string();
+}
+
+const char *mnemonic(Opcode opcode) noexcept{
+    static constexpr const char *MNEMONICS[] = {
+        "E", "N", "G", "L", "P", "O", "Z",
+        "GOTO", "IF TABLE", "DO", "DONE", "FAIL", "HALT", "DUMP", "STATE", "ADVANC",
+        "SS", "D", "GT", "GL", "FR", "E", "DP", "IC", "P",
+        "A", "S", "M", "V", "O", "N", "X", "C", "L", "R",
+        "LO", "LZ", "RO", "RZ", "OS", "ZS",
+        "IN", "PR", "PU", "PL", "BD", "DB", "BO", "OB", "BZ", "ZB",
+        "XR", "YR", "DL", "TH", "TV",
+        "FC", "FC", "FD", "FD",
+        "IF DONE", "IF FAIL", "IF IC", "P LINK", "GT P"
+    };
+    static_assert(sizeof(MNEMONICS) / sizeof(MNEMONICS[0])
+                  == static_cast<unsigned>(Opcode::OPCODE_COUNT),
+                  "Every opcode needs a mnemonic.");
+    auto index = static_cast<unsigned>(opcode);
+    return (index < static_cast<unsigned>(Opcode::OPCODE_COUNT)) ? MNEMONICS[index] : "?";
+}
+
+} // end namespace elsix
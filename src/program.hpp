@@ -0,0 +1,339 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The lowered form of an L6 program, which the back ends execute or translate.
+ *
+ * Lowering (see lowering.hpp) flattens the AST into a sequence of instructions. Each LINE becomes
+ * a run of instructions: its tests become compare-and-branch instructions, its THEN operations
+ * follow, and its GOTO becomes a jump, call, or return. Labels are resolved to instruction
+ * indices, and the names of operands such as `XDB` are decoded once into a bug and a path of
+ * field names, so no back end looks at text.
+ *
+ * Everything is held in flat arrays of plain structures that refer to one another by index.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "field.hpp"
+
+namespace elsix{
+
+/// Fields are named `0` through `9` and `A` through `Z`.
+constexpr unsigned FIELD_COUNT = 36;
+/// Bugs are named `A` through `Z`.
+constexpr unsigned BUG_NAME_COUNT = 26;
+/// Marks the absence of a field, a label, or a jump target.
+constexpr std::uint32_t NO_INDEX = 0xffffffff;
+
+/// The index of the field named `name`, or `FIELD_COUNT` if it is not a field name.
+constexpr unsigned field_index(char name) noexcept{
+    if(name >= '0' && name <= '9'){
+        return static_cast<unsigned>(name - '0');
+    }
+    if(name >= 'A' && name <= 'Z'){
+        return static_cast<unsigned>(name - 'A') + 10;
+    }
+    if(name >= 'a' && name <= 'z'){
+        return static_cast<unsigned>(name - 'a') + 10;
+    }
+    return FIELD_COUNT;
+}
+
+constexpr char field_name(unsigned index) noexcept{
+    return (index < 10) ? static_cast<char>('0' + index) : static_cast<char>('A' + index - 10);
+}
+
+enum class OperandKind: std::uint8_t{
+    NONE,
+    LITERAL,    // A number or Hollerith literal, in `value`.
+    BUG,        // The bug `bug`.
+    FIELD,      // A field reached from bug `bug` through the field names of its path.
+    CLOCK,      // `T.`
+    AVAILABLE   // `n.`, with the order `n` in `value`.
+};
+
+/**
+ * @brief An operand of an instruction.
+ *
+ * The contents `XDB` is bug `X` with the path `D`, `B`: the field `D` of the block `X` points to
+ * holds a pointer, and the operand is field `B` of the block it points to.
+ */
+struct Operand{
+    OperandKind kind = OperandKind::NONE;
+    std::uint8_t bug = 0;
+    // The number of field names in the path.
+    std::uint8_t length = 0;
+    // How many of the accesses along the path, from the first, the verifier has proven need no
+    // checks (see verifier.hpp).
+    std::uint8_t unchecked = 0;
+    // The path is `Program::paths[path]` onward, as field indices.
+    std::uint32_t path = 0;
+    Word value = 0;
+};
+
+enum class Opcode: std::uint8_t{
+    // region: Control
+
+    // Compare operands 0 and 1 and jump to `target` if the test holds, or if it fails when the
+    // INVERT flag is set.
+    TEST_EQUAL,
+    TEST_NOT_EQUAL,
+    TEST_GREATER,
+    TEST_LESS,
+    TEST_SAME_BLOCK,
+    TEST_ONE_BITS,
+    TEST_ZERO_BITS,
+    JUMP,
+    // A ladder of equality tests of one operand (see conditions.hpp), which takes the place of
+    // its first test. Compare operand 0 with the `operands[2]` cases from
+    // `Program::cases[operands[3]]` on, and jump to the target of the case it equals, or to
+    // `alternate` if it equals none. Operand 1 and `target` are still those of the first test.
+    SWITCH,
+    // `(DO, s)` and `(s2, DO, s)`: call the subroutine at `target`. If it returns by FAIL and
+    // `alternate` is not `NO_INDEX`, continue at `alternate`.
+    CALL,
+    // DONE and FAIL: return from the current subroutine, or end the program.
+    RETURN_DONE,
+    RETURN_FAIL,
+    // The end of the program text, reached by falling through the last line.
+    HALT,
+    DUMP,
+    STATE,
+    ADVANCE,
+
+    // endregion: Control
+
+    // region: Operations. Operand 0 is the destination unless noted.
+
+    SETUP_STORAGE,          // (s1, SS, d, s2), no destination.
+    DEFINE_FIELD,           // (word, Df, first, last) defines `field`; no destination.
+    GET_BLOCK,              // (a, GT, cd) or (a, GT, cd, a2).
+    GET_CHAIN,              // (a, GL, cd, n, f); operand 3 holds the field indices.
+    FREE_BLOCK,             // (a, FR, c), where c may be the literal 0.
+    SET_EQUAL,
+    DUPLICATE_BLOCK,
+    INTERCHANGE,
+    POINT,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    OR,
+    AND,
+    EXCLUSIVE_OR,
+    COMPLEMENT,
+    SHIFT_LEFT,             // (a, L, cd), or (a, L, cd, co), which fills from co.
+    SHIFT_RIGHT,
+    LEFT_ONE,
+    LEFT_ZERO,
+    RIGHT_ONE,
+    RIGHT_ZERO,
+    COUNT_ONES,
+    COUNT_ZEROES,
+    INPUT,
+    PRINT,                  // (cd, PR, co), no destination.
+    PUNCH,                  // (cd, PU, co), no destination.
+    PRINT_LIST,             // (c, PL, f) or (c, PL, f, cd), no destination.
+    BINARY_TO_DECIMAL,
+    DECIMAL_TO_BINARY,
+    BINARY_TO_OCTAL,
+    OCTAL_TO_BINARY,
+    BLANKS_TO_ZEROES,
+    ZEROES_TO_BLANKS,
+    X_RANGE,                // No destination.
+    Y_RANGE,
+    DRAW,                   // (x0, DL, y0) or (x0, DL, y0, x1, y1), no destination.
+    TYPE_HORIZONTALLY,      // (x, TH, y, co, cd), no destination.
+    TYPE_VERTICALLY,
+    SAVE_FIELD_CONTENTS,    // (S, FC, c): operand 0 is c.
+    RESTORE_FIELD_CONTENTS, // (R, FC, c): operand 0 is c.
+    SAVE_FIELD_DEFINITION,  // (S, FD, f) saves `field`.
+    RESTORE_FIELD_DEFINITION,
+
+    // endregion: Operations
+
+    // region: Superinstructions, which fusion makes (see fusion.hpp). All but FOLLOW_LINK stand
+    // for an instruction and the one after it, which stays where it was.
+
+    // A test, whose opcode is in `field`, followed by DONE or FAIL: jump to `target` as the test
+    // would, or else return.
+    TEST_OR_DONE,
+    TEST_OR_FAIL,
+    // A test followed by IC of its two operands: jump as the test would, or else interchange them.
+    TEST_OR_INTERCHANGE,
+    // `(X, P, XA)` or `(X, A)`: the bug X = field `field` of the block X points to.
+    FOLLOW_LINK,
+    // `(W, GT, n, WA)` followed by an E or P that copies W to operand 3, as in `(WAD, P, W)`.
+    GET_BLOCK_AND_LINK,
+
+    // endregion: Superinstructions
+
+    OPCODE_COUNT
+};
+
+/// Instruction flags.
+constexpr std::uint8_t INVERT = 0x01;
+
+struct Instruction{
+    Opcode opcode = Opcode::HALT;
+    std::uint8_t flags = 0;
+    // The field of DEFINE_FIELD, SAVE_FIELD_DEFINITION, RESTORE_FIELD_DEFINITION, and
+    // FOLLOW_LINK. The opcode of the test of TEST_OR_DONE, TEST_OR_FAIL, and TEST_OR_INTERCHANGE.
+    std::uint8_t field = 0;
+    std::uint8_t operand_count = 0;
+    // The index of the line the instruction belongs to.
+    std::uint32_t line = 0;
+    std::uint32_t target = NO_INDEX;
+    std::uint32_t alternate = NO_INDEX;
+    // Indices into `Program::operands`.
+    std::array<std::uint32_t, 5> operands{};
+};
+
+/// A line of the source program.
+struct LineInfo{
+    // The index of the first instruction of the line.
+    std::uint32_t first = 0;
+    // The label, as an offset and length within `Program::strings`, or `NO_INDEX`.
+    std::uint32_t label = NO_INDEX;
+    std::uint32_t label_length = 0;
+    // Where the line is in the source, for messages.
+    std::uint32_t row = 0;
+    std::uint32_t column = 0;
+};
+
+/// A case of a SWITCH: where to continue if the operand is `value`.
+struct SwitchCase{
+    Word value = 0;
+    std::uint32_t target = NO_INDEX;
+};
+
+struct Program{
+    std::vector<Instruction> instructions;
+    std::vector<Operand> operands;
+    std::vector<std::uint8_t> paths;
+    std::vector<LineInfo> lines;
+    // The cases of each SWITCH, in increasing order of value.
+    std::vector<SwitchCase> cases;
+    // Label text, referred to by `LineInfo::label`.
+    std::string strings;
+
+    [[nodiscard]] const Operand &operand(const Instruction &instruction, unsigned i) const noexcept{
+        return operands[instruction.operands[i]];
+    }
+
+    [[nodiscard]] std::string_view label(const LineInfo &line) const noexcept{
+        return (NO_INDEX == line.label) ? std::string_view()
+                                        : std::string_view(strings).substr(line.label,
+                                                                           line.label_length);
+    }
+
+    /// The index of the line labeled `label`, or `NO_INDEX`.
+    [[nodiscard]] std::uint32_t find_label(std::string_view label) const noexcept;
+
+    /// The name of an operand as it would be written in L6, such as `XDB`, `T.`, or `25`.
+    [[nodiscard]] std::string operand_name(const Operand &operand) const;
+};
+
+/// The L6 mnemonic of an opcode, such as `GT`, for listings.
+[[nodiscard]] const char *mnemonic(Opcode opcode) noexcept;
+
+/// Is this one of the compare-and-branch tests?
+constexpr bool is_test(Opcode opcode) noexcept{
+    return opcode <= Opcode::TEST_ZERO_BITS;
+}
+
+/// Does the test `opcode` hold for the operands `a` and `b`?
+constexpr bool test_holds(Opcode opcode, Word a, Word b) noexcept{
+    switch(opcode){
+        case Opcode::TEST_EQUAL:[[fallthrough]];
+        case Opcode::TEST_SAME_BLOCK:return a == b;
+        case Opcode::TEST_NOT_EQUAL:return a != b;
+        case Opcode::TEST_GREATER:return a > b;
+        case Opcode::TEST_LESS:return a < b;
+        case Opcode::TEST_ONE_BITS:return 0 == (b & ~a);
+        case Opcode::TEST_ZERO_BITS:return 0 == (a & ~b);
+        default:return false;
+    }
+}
+
+/// Does control never continue to the following instruction?
+constexpr bool ends_block(Opcode opcode) noexcept{
+    return Opcode::JUMP == opcode || Opcode::RETURN_DONE == opcode
+           || Opcode::RETURN_FAIL == opcode || Opcode::HALT == opcode;
+}
+
+/// Does operand 0 of the instruction receive its result?
+constexpr bool writes_operand0(Opcode opcode) noexcept{
+    switch(opcode){
+        case Opcode::GET_BLOCK:
+        case Opcode::GET_CHAIN:
+        case Opcode::FREE_BLOCK:
+        case Opcode::SET_EQUAL:
+        case Opcode::DUPLICATE_BLOCK:
+        case Opcode::INTERCHANGE:
+        case Opcode::POINT:
+        case Opcode::ADD:
+        case Opcode::SUBTRACT:
+        case Opcode::MULTIPLY:
+        case Opcode::DIVIDE:
+        case Opcode::OR:
+        case Opcode::AND:
+        case Opcode::EXCLUSIVE_OR:
+        case Opcode::COMPLEMENT:
+        case Opcode::SHIFT_LEFT:
+        case Opcode::SHIFT_RIGHT:
+        case Opcode::LEFT_ONE:
+        case Opcode::LEFT_ZERO:
+        case Opcode::RIGHT_ONE:
+        case Opcode::RIGHT_ZERO:
+        case Opcode::COUNT_ONES:
+        case Opcode::COUNT_ZEROES:
+        case Opcode::INPUT:
+        case Opcode::BINARY_TO_DECIMAL:
+        case Opcode::DECIMAL_TO_BINARY:
+        case Opcode::BINARY_TO_OCTAL:
+        case Opcode::OCTAL_TO_BINARY:
+        case Opcode::BLANKS_TO_ZEROES:
+        case Opcode::ZEROES_TO_BLANKS:
+        case Opcode::RESTORE_FIELD_CONTENTS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // end namespace elsix
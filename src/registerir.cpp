@@ -0,0 +1,1059 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+#include <algorithm>
+
+#include "fmt/format.h"
+
+#include "registerir.hpp"
+#include "controlflow.hpp"
+#include "conversion.hpp"
+#include "fusion.hpp"
+#include "runtime.hpp"
+
+namespace elsix{
+
+namespace{
+
+// region: Translation
+
+/// Operations that store in operand 0 a value computed from operand 1 alone.
+constexpr bool is_unary(Opcode opcode) noexcept{
+    switch(opcode){
+        case Opcode::COMPLEMENT:
+        case Opcode::LEFT_ONE:
+        case Opcode::LEFT_ZERO:
+        case Opcode::RIGHT_ONE:
+        case Opcode::RIGHT_ZERO:
+        case Opcode::COUNT_ONES:
+        case Opcode::COUNT_ZEROES:
+        case Opcode::BINARY_TO_DECIMAL:
+        case Opcode::DECIMAL_TO_BINARY:
+        case Opcode::BINARY_TO_OCTAL:
+        case Opcode::OCTAL_TO_BINARY:
+        case Opcode::BLANKS_TO_ZEROES:
+        case Opcode::ZEROES_TO_BLANKS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// Operations that store in operand 0 a value computed from operands 0 and 1.
+constexpr bool is_binary(Opcode opcode) noexcept{
+    switch(opcode){
+        case Opcode::ADD:
+        case Opcode::SUBTRACT:
+        case Opcode::MULTIPLY:
+        case Opcode::DIVIDE:
+        case Opcode::OR:
+        case Opcode::AND:
+        case Opcode::EXCLUSIVE_OR:
+        case Opcode::SHIFT_LEFT:
+        case Opcode::SHIFT_RIGHT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+class Translator{
+public:
+    Translator(const Program &program, RegisterProgram &registers)
+        : program_(program), registers_(registers){}
+
+    /// Appends the register instructions of instruction `index` of the program.
+    void translate(std::uint32_t index);
+
+private:
+    const Program &program_;
+    RegisterProgram &registers_;
+    std::uint32_t index_ = 0;
+
+    Register temporary_(){
+        return registers_.register_count++;
+    }
+
+    RegisterInstruction &emit_(RegisterOp op, Opcode opcode, Register destination);
+    void add_source_(RegisterInstruction &instruction, Register source){
+        instruction.sources[instruction.source_count++] = source;
+    }
+
+    /// Loads the `i`th field of the path of `operand` from the block at `base`.
+    Register load_(const Operand &operand, unsigned i, Register base);
+    /// Loads all but the last field of the path of `operand`, giving the block of the last.
+    Register address_(const Operand &operand);
+    Register read_(const Operand &operand);
+    void write_(const Operand &operand, Register value);
+    /// A temporary holding what `source` holds now, for a bug about to be stored to.
+    Register copy_(Register source);
+    /// `operand` = `opcode` of `a` and `b`, or of `b` alone for a unary operation. A shift may
+    /// take a `fill` as its third source.
+    void update_(const Operand &operand, Opcode opcode, const Operand &b_operand,
+                 const Operand *fill = nullptr);
+    /**
+     * @brief An OPERATE of `count` operands of `instruction` from `first` on, which stores its
+     * result, if it has one, in operand 0.
+     * @return The index of the OPERATE.
+     */
+    std::size_t operate_(const Instruction &instruction, unsigned first, unsigned count,
+                         bool result);
+};
+
+RegisterInstruction &Translator::emit_(RegisterOp op, Opcode opcode, Register destination){
+    RegisterInstruction instruction;
+    instruction.op = op;
+    instruction.opcode = opcode;
+    instruction.destination = destination;
+    instruction.source = index_;
+    registers_.instructions.push_back(instruction);
+    return registers_.instructions.back();
+}
+
+Register Translator::load_(const Operand &operand, unsigned i, Register base){
+    Register destination = temporary_();
+    RegisterInstruction &load = emit_(RegisterOp::LOAD, Opcode::HALT, destination);
+    load.field = program_.paths[operand.path + i];
+    load.flags = (i < operand.unchecked) ? 0 : CHECKED;
+    add_source_(load, base);
+    return destination;
+}
+
+Register Translator::address_(const Operand &operand){
+    Register base = operand.bug;
+    for(unsigned i = 0; i + 1 < operand.length; i++){
+        base = load_(operand, i, base);
+    }
+    return base;
+}
+
+Register Translator::read_(const Operand &operand){
+    switch(operand.kind){
+        case OperandKind::BUG:
+            return operand.bug;
+        case OperandKind::FIELD:
+            return load_(operand, operand.length - 1u, address_(operand));
+        case OperandKind::CLOCK:
+            return emit_(RegisterOp::TIME, Opcode::HALT, temporary_()).destination;
+        case OperandKind::AVAILABLE:{
+            RegisterInstruction &available = emit_(RegisterOp::AVAILABLE, Opcode::HALT,
+                                                   temporary_());
+            available.value = operand.value;
+            return available.destination;
+        }
+        default:{
+            RegisterInstruction &constant = emit_(RegisterOp::CONSTANT, Opcode::HALT,
+                                                  temporary_());
+            constant.value = operand.value;
+            return constant.destination;
+        }
+    }
+}
+
+void Translator::write_(const Operand &operand, Register value){
+    if(OperandKind::BUG == operand.kind){
+        if(value != operand.bug){
+            add_source_(emit_(RegisterOp::MOVE, Opcode::SET_EQUAL, operand.bug), value);
+        }
+    } else if(OperandKind::FIELD == operand.kind){
+        Register base = address_(operand);
+        RegisterInstruction &store = emit_(RegisterOp::STORE, Opcode::HALT, NO_REGISTER);
+        store.field = program_.paths[operand.path + operand.length - 1];
+        store.flags = (operand.length <= operand.unchecked) ? 0 : CHECKED;
+        add_source_(store, base);
+        add_source_(store, value);
+    } else{
+        // The runtime faults.
+        add_source_(emit_(RegisterOp::OPERATE, program_.instructions[index_].opcode,
+                          NO_REGISTER), value);
+    }
+}
+
+Register Translator::copy_(Register source){
+    if(source >= FIRST_TEMPORARY){
+        return source;
+    }
+    Register destination = temporary_();
+    add_source_(emit_(RegisterOp::MOVE, Opcode::SET_EQUAL, destination), source);
+    return destination;
+}
+
+void Translator::update_(const Operand &operand, Opcode opcode, const Operand &b_operand,
+                         const Operand *fill){
+    bool unary = !is_binary(opcode);
+    bool copies = Opcode::SET_EQUAL == opcode || Opcode::POINT == opcode;
+    if(OperandKind::FIELD != operand.kind){
+        Register b = read_(b_operand);
+        Register c = (nullptr != fill) ? read_(*fill) : NO_REGISTER;
+        if(copies){
+            write_(operand, b);
+            return;
+        }
+        RegisterInstruction &compute = emit_(RegisterOp::COMPUTE, opcode, operand.bug);
+        if(!unary){
+            add_source_(compute, operand.bug);
+        }
+        add_source_(compute, b);
+        if(nullptr != fill){
+            add_source_(compute, c);
+        }
+        return;
+    }
+
+    // The address first, then the field, then operand 1, as the interpreter goes.
+    Register base = address_(operand);
+    unsigned last = operand.length - 1u;
+    Register a = unary ? NO_REGISTER : load_(operand, last, base);
+    Register b = read_(b_operand);
+    Register c = (nullptr != fill) ? read_(*fill) : NO_REGISTER;
+    Register value = b;
+    if(!copies){
+        value = temporary_();
+        RegisterInstruction &compute = emit_(RegisterOp::COMPUTE, opcode, value);
+        if(!unary){
+            add_source_(compute, a);
+        }
+        add_source_(compute, b);
+        if(nullptr != fill){
+            add_source_(compute, c);
+        }
+    }
+    RegisterInstruction &store = emit_(RegisterOp::STORE, Opcode::HALT, NO_REGISTER);
+    store.field = program_.paths[operand.path + last];
+    store.flags = (operand.length <= operand.unchecked) ? 0 : CHECKED;
+    add_source_(store, base);
+    add_source_(store, value);
+}
+
+std::size_t Translator::operate_(const Instruction &instruction, unsigned first, unsigned count,
+                                 bool result){
+    std::array<Register, 5> sources{};
+    for(unsigned i = 0; i < count; i++){
+        sources[i] = read_(program_.operand(instruction, first + i));
+    }
+    Register destination = result ? temporary_() : NO_REGISTER;
+    RegisterInstruction &operate = emit_(RegisterOp::OPERATE, instruction.opcode, destination);
+    operate.field = instruction.field;
+    operate.target = instruction.target;
+    operate.alternate = instruction.alternate;
+    for(unsigned i = 0; i < count; i++){
+        add_source_(operate, sources[i]);
+    }
+    std::size_t index = registers_.instructions.size() - 1;
+    if(result){
+        write_(program_.operand(instruction, 0), destination);
+    }
+    return index;
+}
+
+void Translator::translate(std::uint32_t index){
+    index_ = index;
+    Instruction instruction = unfused(program_.instructions[index]);
+    auto operand = [&](unsigned i) -> const Operand &{ return program_.operand(instruction, i); };
+    Opcode opcode = instruction.opcode;
+
+    if(is_test(opcode)){
+        Register a = read_(operand(0));
+        Register b = read_(operand(1));
+        RegisterInstruction &test = emit_(RegisterOp::TEST, opcode, NO_REGISTER);
+        test.flags = instruction.flags & INVERT;
+        test.target = instruction.target;
+        add_source_(test, a);
+        add_source_(test, b);
+        return;
+    }
+    if(Opcode::SET_EQUAL == opcode || Opcode::POINT == opcode || is_unary(opcode)
+       || (is_binary(opcode) && 3 != instruction.operand_count)){
+        update_(operand(0), opcode, operand(1));
+        return;
+    }
+
+    switch(opcode){
+        case Opcode::SWITCH:
+            operate_(instruction, 0, 1, false);
+            registers_.instructions.back().value = instruction.operands[2];
+            return;
+        case Opcode::GET_BLOCK:{
+            // GT reads operand 0 before it stores the new block there.
+            Register old = read_(operand(0));
+            if(3 == instruction.operand_count){
+                old = copy_(old);
+            }
+            registers_.instructions[operate_(instruction, 1, 1, true)].field = operand(0).bug;
+            if(3 == instruction.operand_count){
+                write_(operand(2), old);
+            }
+            return;
+        }
+        case Opcode::GET_CHAIN:
+            registers_.instructions[operate_(instruction, 1, 3, true)].field = operand(0).bug;
+            return;
+        case Opcode::FREE_BLOCK:{
+            Register replacement = read_(operand(1));
+            operate_(instruction, 0, 1, false);
+            write_(operand(0), replacement);
+            return;
+        }
+        case Opcode::DUPLICATE_BLOCK:
+        case Opcode::INPUT:
+            operate_(instruction, 1, 1, true);
+            return;
+        case Opcode::RESTORE_FIELD_CONTENTS:
+            operate_(instruction, 0, 0, true);
+            return;
+        case Opcode::INTERCHANGE:{
+            Register first = copy_(read_(operand(0)));
+            Register second = read_(operand(1));
+            write_(operand(0), second);
+            write_(operand(1), first);
+            return;
+        }
+        case Opcode::SHIFT_LEFT:
+        case Opcode::SHIFT_RIGHT:
+            // (a, L, cd, co): a shifted by cd, filled from co.
+            update_(operand(0), opcode, operand(1), &operand(2));
+            return;
+        default:
+            operate_(instruction, 0, instruction.operand_count, false);
+            return;
+    }
+}
+
+// endregion: Translation
+
+// region: Optimization
+
+/// Computes `opcode` of constants, unless it would fault. Unary operations take `a`.
+bool fold(Opcode opcode, Word a, Word b, Word &result) noexcept{
+    switch(opcode){
+        case Opcode::ADD:result = a + b; return true;
+        case Opcode::SUBTRACT:result = a - b; return true;
+        case Opcode::MULTIPLY:result = a * b; return true;
+        case Opcode::DIVIDE:
+            if(0 == b){
+                return false;
+            }
+            result = a / b;
+            return true;
+        case Opcode::OR:result = a | b; return true;
+        case Opcode::AND:result = a & b; return true;
+        case Opcode::EXCLUSIVE_OR:result = a ^ b; return true;
+        case Opcode::COMPLEMENT:result = ~a; return true;
+        case Opcode::SHIFT_LEFT:result = shift_left(a, b); return true;
+        case Opcode::SHIFT_RIGHT:result = shift_right(a, b); return true;
+        case Opcode::LEFT_ONE:result = left_one(a); return true;
+        case Opcode::LEFT_ZERO:result = left_zero(a); return true;
+        case Opcode::RIGHT_ONE:result = right_one(a); return true;
+        case Opcode::RIGHT_ZERO:result = right_zero(a); return true;
+        case Opcode::COUNT_ONES:result = count_ones(a); return true;
+        case Opcode::COUNT_ZEROES:result = count_zeroes(a); return true;
+        case Opcode::BINARY_TO_DECIMAL:result = binary_to_decimal(a); return true;
+        case Opcode::DECIMAL_TO_BINARY:result = decimal_to_binary(a); return true;
+        case Opcode::BINARY_TO_OCTAL:result = binary_to_octal(a); return true;
+        case Opcode::OCTAL_TO_BINARY:result = octal_to_binary(a); return true;
+        case Opcode::BLANKS_TO_ZEROES:result = blanks_to_zeroes(a); return true;
+        case Opcode::ZEROES_TO_BLANKS:result = zeroes_to_blanks(a); return true;
+        default:return false;
+    }
+}
+
+/// Computes a shift of `a` by `b` that fills from `c`, as `(a, L, cd, co)` does.
+bool fold_filling(Opcode opcode, Word a, Word b, Word c, Word &result) noexcept{
+    switch(opcode){
+        case Opcode::SHIFT_LEFT:result = shift_left_filling(a, b, c); return true;
+        case Opcode::SHIFT_RIGHT:result = shift_right_filling(a, b, c); return true;
+        default:return false;
+    }
+}
+
+/// Could the instruction be dropped if nothing used its result?
+bool is_pure(const RegisterInstruction &instruction) noexcept{
+    switch(instruction.op){
+        case RegisterOp::CONSTANT:
+        case RegisterOp::MOVE:
+        case RegisterOp::TIME:
+        case RegisterOp::AVAILABLE:
+            return true;
+        case RegisterOp::LOAD:
+            return 0 == (instruction.flags & CHECKED);
+        case RegisterOp::COMPUTE:
+            return Opcode::DIVIDE != instruction.opcode;
+        default:
+            return false;
+    }
+}
+
+class Optimizer{
+public:
+    explicit Optimizer(RegisterProgram &registers)
+        : registers_(registers), removed_(registers.instructions.size(), false),
+          replacements_(registers.register_count), versions_(registers.register_count, 0),
+          known_(registers.register_count, false), values_(registers.register_count, 0),
+          live_(registers.register_count, false){
+        for(Register r = 0; r < registers.register_count; r++){
+            replacements_[r] = r;
+        }
+    }
+
+    /// Optimizes instructions `begin` up to `end`, which control enters only at `begin`.
+    void optimize(std::uint32_t begin, std::uint32_t end){
+        forward_(begin, end);
+        backward_(begin, end);
+    }
+
+    /// Drops the removed instructions. Returns how many there were.
+    std::size_t compact();
+
+private:
+    /// A field loaded from the block a register held when it had a particular version.
+    struct Access{
+        unsigned field;
+        Register base;
+        std::uint32_t version;
+        // The register loaded, or the instruction that stored.
+        std::uint32_t result;
+    };
+
+    RegisterProgram &registers_;
+    std::vector<bool> removed_;
+    // Temporaries that hold the same value as another, which uses take instead.
+    std::vector<Register> replacements_;
+    // Bumped whenever a register is written, so that a fact about it can tell it is stale.
+    std::vector<std::uint32_t> versions_;
+    std::vector<bool> known_;
+    std::vector<Word> values_;
+    std::vector<bool> live_;
+    std::vector<Access> loads_;
+    std::vector<Access> stores_;
+
+    void forward_(std::uint32_t begin, std::uint32_t end);
+    void backward_(std::uint32_t begin, std::uint32_t end);
+    void written_(Register r){
+        versions_[r]++;
+        known_[r] = false;
+    }
+    void make_constant_(RegisterInstruction &instruction, Word value){
+        instruction.op = RegisterOp::CONSTANT;
+        instruction.value = value;
+        instruction.source_count = 0;
+    }
+    [[nodiscard]] const Access *find_(const std::vector<Access> &accesses, unsigned field,
+                                      Register base) const{
+        for(const Access &access : accesses){
+            if(access.field == field && access.base == base && access.version == versions_[base]){
+                return &access;
+            }
+        }
+        return nullptr;
+    }
+};
+
+void Optimizer::forward_(std::uint32_t begin, std::uint32_t end){
+    for(Register bug = 0; bug < FIRST_TEMPORARY; bug++){
+        known_[bug] = false;
+    }
+    loads_.clear();
+    stores_.clear();
+
+    for(std::uint32_t i = begin; i < end; i++){
+        RegisterInstruction &instruction = registers_.instructions[i];
+        bool all_known = true;
+        for(unsigned s = 0; s < instruction.source_count; s++){
+            instruction.sources[s] = replacements_[instruction.sources[s]];
+            all_known = all_known && known_[instruction.sources[s]];
+        }
+        Word a = known_[instruction.sources[0]] ? values_[instruction.sources[0]] : 0;
+        Word b = (instruction.source_count > 1 && all_known) ? values_[instruction.sources[1]] : 0;
+        Word c = (instruction.source_count > 2 && all_known) ? values_[instruction.sources[2]] : 0;
+        Register destination = instruction.destination;
+
+        switch(instruction.op){
+            case RegisterOp::MOVE:
+                if(all_known){
+                    make_constant_(instruction, a);
+                } else if(destination >= FIRST_TEMPORARY
+                          && instruction.sources[0] >= FIRST_TEMPORARY){
+                    replacements_[destination] = instruction.sources[0];
+                    removed_[i] = true;
+                    continue;
+                }
+                break;
+            case RegisterOp::LOAD:
+                if(const Access *load = find_(loads_, instruction.field, instruction.sources[0])){
+                    replacements_[destination] = load->result;
+                    removed_[i] = true;
+                    continue;
+                }
+                // Nothing may come between a store and a load of what it stored.
+                stores_.clear();
+                loads_.push_back({instruction.field, instruction.sources[0],
+                                  versions_[instruction.sources[0]], destination});
+                break;
+            case RegisterOp::STORE:{
+                loads_.clear();
+                // The earlier store goes if this one checks whatever it checked.
+                const Access *store = find_(stores_, instruction.field, instruction.sources[0]);
+                if(nullptr != store
+                   && (0 != (instruction.flags & CHECKED)
+                       || 0 == (registers_.instructions[store->result].flags & CHECKED))){
+                    removed_[store->result] = true;
+                    stores_.erase(stores_.begin() + (store - stores_.data()));
+                }
+                stores_.push_back({instruction.field, instruction.sources[0],
+                                   versions_[instruction.sources[0]], i});
+                break;
+            }
+            case RegisterOp::COMPUTE:{
+                Word value;
+                if(all_known && ((3 == instruction.source_count)
+                                 ? fold_filling(instruction.opcode, a, b, c, value)
+                                 : fold(instruction.opcode, a, b, value))){
+                    make_constant_(instruction, value);
+                }
+                break;
+            }
+            case RegisterOp::TEST:
+                stores_.clear();
+                if(all_known){
+                    if(test_holds(instruction.opcode, a, b) != (0 != (instruction.flags & INVERT))){
+                        instruction.op = RegisterOp::OPERATE;
+                        instruction.opcode = Opcode::JUMP;
+                        instruction.source_count = 0;
+                    } else{
+                        removed_[i] = true;
+                    }
+                }
+                continue;
+            case RegisterOp::OPERATE:
+                loads_.clear();
+                stores_.clear();
+                break;
+            default:
+                break;
+        }
+
+        if(NO_REGISTER != destination){
+            written_(destination);
+            if(RegisterOp::CONSTANT == instruction.op){
+                known_[destination] = true;
+                values_[destination] = instruction.value;
+            }
+        }
+    }
+}
+
+void Optimizer::backward_(std::uint32_t begin, std::uint32_t end){
+    // Temporaries are dead past the end of the block; bugs may be used anywhere after it.
+    for(Register bug = 0; bug < FIRST_TEMPORARY; bug++){
+        live_[bug] = true;
+    }
+    for(std::uint32_t i = end; i-- > begin;){
+        if(removed_[i]){
+            continue;
+        }
+        const RegisterInstruction &instruction = registers_.instructions[i];
+        if(NO_REGISTER != instruction.destination){
+            if(!live_[instruction.destination] && is_pure(instruction)){
+                removed_[i] = true;
+                continue;
+            }
+            live_[instruction.destination] = false;
+        }
+        for(unsigned s = 0; s < instruction.source_count; s++){
+            live_[instruction.sources[s]] = true;
+        }
+        // A test may leave the block, and the runtime may read any bug, as DUMP does.
+        if(RegisterOp::TEST == instruction.op || RegisterOp::OPERATE == instruction.op){
+            for(Register bug = 0; bug < FIRST_TEMPORARY; bug++){
+                live_[bug] = true;
+            }
+        }
+    }
+}
+
+std::size_t Optimizer::compact(){
+    std::vector<RegisterInstruction> &instructions = registers_.instructions;
+    std::vector<std::uint32_t> &starts = registers_.starts;
+    std::uint32_t kept = 0;
+    std::size_t start = 0;
+    for(std::uint32_t i = 0; i < instructions.size(); i++){
+        while(start < starts.size() && starts[start] == i){
+            starts[start++] = kept;
+        }
+        if(!removed_[i]){
+            instructions[kept++] = instructions[i];
+        }
+    }
+    while(start < starts.size()){
+        starts[start++] = kept;
+    }
+    std::size_t removed = instructions.size() - kept;
+    instructions.resize(kept);
+    removed_.assign(kept, false);
+    return removed;
+}
+
+// endregion: Optimization
+
+// region: Lowered rewrites
+
+/// How an instruction uses its operands, for the rewrites of the lowered form.
+enum class Shape: std::uint8_t{
+    TEST,       // Reads operands 0 and 1.
+    COPY,       // E and P: operand 0 = operand 1.
+    UNARY,      // Operand 0 = an operation of operand 1.
+    BINARY,     // Operand 0 = an operation of operands 0 and 1.
+    OTHER       // Anything else, about which nothing is assumed.
+};
+
+Shape shape(const Instruction &instruction) noexcept{
+    Opcode opcode = instruction.opcode;
+    if(2 != instruction.operand_count){
+        return Shape::OTHER;
+    }
+    if(is_test(opcode)){
+        return Shape::TEST;
+    }
+    if(Opcode::SET_EQUAL == opcode || Opcode::POINT == opcode){
+        return Shape::COPY;
+    }
+    if(is_unary(opcode)){
+        return Shape::UNARY;
+    }
+    return is_binary(opcode) ? Shape::BINARY : Shape::OTHER;
+}
+
+class Simplifier{
+public:
+    explicit Simplifier(Program &program)
+        : program_(program), drop_(program.instructions.size(), false){}
+
+    /// Simplifies instructions `begin` up to `end`, which control enters only at `begin`.
+    void simplify(std::uint32_t begin, std::uint32_t end){
+        forward_(begin, end);
+        backward_(begin, end);
+    }
+
+    [[nodiscard]] const std::vector<bool> &dropped() const noexcept{
+        return drop_;
+    }
+
+    [[nodiscard]] std::size_t changed() const noexcept{
+        return changed_;
+    }
+
+private:
+    /// The bug `holder` holds the field the path `path`, of `length` fields, reaches from `base`.
+    struct Copy{
+        unsigned holder;
+        unsigned base;
+        std::uint32_t path;
+        unsigned length;
+    };
+
+    /// Instruction `instruction` stored to field `field` of the block bug `bug` points to.
+    struct Store{
+        unsigned bug;
+        unsigned field;
+        std::uint32_t instruction;
+    };
+
+    Program &program_;
+    std::vector<bool> drop_;
+    std::size_t changed_ = 0;
+    std::array<bool, BUG_NAME_COUNT> known_{};
+    std::array<Word, BUG_NAME_COUNT> values_{};
+    std::vector<Copy> copies_;
+    std::vector<Store> stores_;
+
+    void forward_(std::uint32_t begin, std::uint32_t end);
+    void backward_(std::uint32_t begin, std::uint32_t end);
+
+    /// Forgets what was known about bug `bug`, which is about to be written.
+    void written_(unsigned bug);
+    [[nodiscard]] bool constant_(std::uint32_t operand, Word &value) const noexcept;
+    [[nodiscard]] std::uint32_t add_operand_(const Operand &operand);
+    /**
+     * @brief Replaces `operand` with the bug a field along its path was copied to, if there is
+     * one. A `destination` is stored to, so it keeps at least the last field of its path.
+     */
+    void reuse_(std::uint32_t &operand, bool destination);
+};
+
+void Simplifier::written_(unsigned bug){
+    known_[bug] = false;
+    copies_.erase(std::remove_if(copies_.begin(), copies_.end(), [&](const Copy &copy){
+        return copy.holder == bug || copy.base == bug;
+    }), copies_.end());
+    stores_.erase(std::remove_if(stores_.begin(), stores_.end(), [&](const Store &store){
+        return store.bug == bug;
+    }), stores_.end());
+}
+
+bool Simplifier::constant_(std::uint32_t operand, Word &value) const noexcept{
+    const Operand &source = program_.operands[operand];
+    if(OperandKind::LITERAL == source.kind){
+        value = source.value;
+        return true;
+    }
+    if(OperandKind::BUG == source.kind && known_[source.bug]){
+        value = values_[source.bug];
+        return true;
+    }
+    return false;
+}
+
+std::uint32_t Simplifier::add_operand_(const Operand &operand){
+    program_.operands.push_back(operand);
+    return static_cast<std::uint32_t>(program_.operands.size() - 1);
+}
+
+void Simplifier::reuse_(std::uint32_t &operand, bool destination){
+    Operand source = program_.operands[operand];
+    if(OperandKind::FIELD != source.kind){
+        return;
+    }
+    const std::vector<std::uint8_t> &paths = program_.paths;
+    for(const Copy &copy : copies_){
+        if(copy.base != source.bug || copy.length > source.length
+           || (destination && copy.length == source.length)
+           || !std::equal(paths.begin() + copy.path, paths.begin() + copy.path + copy.length,
+                          paths.begin() + source.path)){
+            continue;
+        }
+        Operand reused = source;
+        reused.bug = static_cast<std::uint8_t>(copy.holder);
+        reused.unchecked = 0;
+        if(copy.length == source.length){
+            reused.kind = OperandKind::BUG;
+            reused.path = 0;
+            reused.length = 0;
+        } else{
+            reused.path += copy.length;
+            reused.length = static_cast<std::uint8_t>(reused.length - copy.length);
+        }
+        operand = add_operand_(reused);
+        changed_++;
+        return;
+    }
+}
+
+void Simplifier::forward_(std::uint32_t begin, std::uint32_t end){
+    known_.fill(false);
+    copies_.clear();
+    stores_.clear();
+
+    for(std::uint32_t i = begin; i < end; i++){
+        Instruction &instruction = program_.instructions[i];
+        Shape form = shape(instruction);
+        if(Shape::OTHER == form){
+            // The runtime may write any bug operand, and any block.
+            for(unsigned k = 0; k < instruction.operand_count; k++){
+                const Operand &operand = program_.operand(instruction, k);
+                if(OperandKind::BUG == operand.kind || OperandKind::FIELD == operand.kind){
+                    written_(operand.bug);
+                }
+            }
+            copies_.clear();
+            stores_.clear();
+            continue;
+        }
+
+        reuse_(instruction.operands[0], Shape::TEST != form);
+        reuse_(instruction.operands[1], false);
+        Word b = 0;
+        if(constant_(instruction.operands[1], b)
+           && OperandKind::LITERAL != program_.operand(instruction, 1).kind){
+            Operand literal;
+            literal.kind = OperandKind::LITERAL;
+            literal.value = b;
+            instruction.operands[1] = add_operand_(literal);
+            changed_++;
+        }
+        const Operand &first = program_.operand(instruction, 0);
+        const Operand &second = program_.operand(instruction, 1);
+        // Whatever loads a field sees the stores before it.
+        if(Shape::TEST == form || OperandKind::FIELD == second.kind
+           || (OperandKind::FIELD == first.kind && (Shape::BINARY == form || first.length > 1))){
+            stores_.clear();
+        }
+
+        Word a = 0;
+        bool folds = constant_(instruction.operands[1], b)
+                     && (Shape::COPY == form || Shape::UNARY == form
+                         || constant_(instruction.operands[0], a));
+        if(Shape::TEST == form){
+            if(folds){
+                if(test_holds(instruction.opcode, a, b) != (0 != (instruction.flags & INVERT))){
+                    instruction.opcode = Opcode::JUMP;
+                    instruction.flags = 0;
+                    instruction.operand_count = 0;
+                    changed_++;
+                } else if(i + 1 < end){
+                    // The last instruction of a block stays, so no line is left empty.
+                    drop_[i] = true;
+                    changed_++;
+                }
+            }
+            continue;
+        }
+
+        Word value = b;
+        if(OperandKind::BUG == first.kind && folds && Shape::COPY != form
+           && fold(instruction.opcode, Shape::UNARY == form ? b : a, b, value)){
+            Operand literal;
+            literal.kind = OperandKind::LITERAL;
+            literal.value = value;
+            instruction.opcode = Opcode::SET_EQUAL;
+            instruction.operands[1] = add_operand_(literal);
+            form = Shape::COPY;
+            changed_++;
+        }
+
+        const Operand &destination = program_.operand(instruction, 0);
+        const Operand &source = program_.operand(instruction, 1);
+        if(OperandKind::BUG == destination.kind){
+            written_(destination.bug);
+            if(Shape::COPY == form && OperandKind::LITERAL == source.kind){
+                known_[destination.bug] = true;
+                values_[destination.bug] = source.value;
+            } else if(Shape::COPY == form && OperandKind::FIELD == source.kind
+                      && source.bug != destination.bug){
+                copies_.push_back({destination.bug, source.bug, source.path, source.length});
+            }
+            continue;
+        }
+
+        // A store, which may change any field copied.
+        copies_.clear();
+        if(1 != destination.length){
+            continue;
+        }
+        unsigned field = program_.paths[destination.path];
+        auto earlier = std::find_if(stores_.begin(), stores_.end(), [&](const Store &store){
+            return store.bug == destination.bug && store.field == field;
+        });
+        if(stores_.end() != earlier){
+            drop_[earlier->instruction] = true;
+            changed_++;
+            stores_.erase(earlier);
+        }
+        // A store that loads nothing can go if it is stored over before anything loads.
+        if(Shape::COPY == form && OperandKind::FIELD != source.kind){
+            stores_.push_back({destination.bug, field, i});
+        }
+    }
+}
+
+void Simplifier::backward_(std::uint32_t begin, std::uint32_t end){
+    // Bugs may be used anywhere after the block.
+    std::array<bool, BUG_NAME_COUNT> live;
+    live.fill(true);
+    for(std::uint32_t i = end; i-- > begin;){
+        if(drop_[i]){
+            continue;
+        }
+        const Instruction &instruction = program_.instructions[i];
+        Shape form = shape(instruction);
+        // A test may leave the block, and the runtime may read any bug, as DUMP does.
+        if(Shape::TEST == form || Shape::OTHER == form){
+            live.fill(true);
+            continue;
+        }
+        const Operand &destination = program_.operand(instruction, 0);
+        const Operand &source = program_.operand(instruction, 1);
+        if(OperandKind::BUG == destination.kind){
+            // Loads and divisions may fault, so they stay.
+            if(!live[destination.bug] && OperandKind::FIELD != source.kind
+               && Opcode::DIVIDE != instruction.opcode){
+                drop_[i] = true;
+                changed_++;
+                continue;
+            }
+            live[destination.bug] = Shape::BINARY == form;
+        } else{
+            live[destination.bug] = true;
+        }
+        if(OperandKind::BUG == source.kind || OperandKind::FIELD == source.kind){
+            live[source.bug] = true;
+        }
+    }
+}
+
+// endregion: Lowered rewrites
+
+// region: Listing
+
+std::string register_name(Register r){
+    return (r < FIRST_TEMPORARY) ? std::string(1, static_cast<char>('A' + r))
+                                 : fmt::format("t{}", r - FIRST_TEMPORARY);
+}
+
+std::string sources(const RegisterInstruction &instruction, unsigned first = 0){
+    std::string text;
+    for(unsigned s = first; s < instruction.source_count; s++){
+        text += ", " + register_name(instruction.sources[s]);
+    }
+    return text;
+}
+
+std::string format_instruction(const RegisterInstruction &instruction){
+    std::string destination = (NO_REGISTER == instruction.destination)
+                              ? std::string()
+                              : register_name(instruction.destination) + " = ";
+    const char *checks = (0 != (instruction.flags & CHECKED)) ? "" : " unchecked";
+    switch(instruction.op){
+        case RegisterOp::CONSTANT:
+            return destination + std::to_string(instruction.value);
+        case RegisterOp::MOVE:
+            return destination + register_name(instruction.sources[0]);
+        case RegisterOp::TIME:
+            return destination + "T.";
+        case RegisterOp::AVAILABLE:
+            return destination + std::to_string(instruction.value) + ".";
+        case RegisterOp::LOAD:
+            return fmt::format("{}load{} {} of {}", destination, checks,
+                               field_name(instruction.field),
+                               register_name(instruction.sources[0]));
+        case RegisterOp::STORE:
+            return fmt::format("store{} {} of {} = {}", checks, field_name(instruction.field),
+                               register_name(instruction.sources[0]),
+                               register_name(instruction.sources[1]));
+        case RegisterOp::COMPUTE:
+            if(1 == instruction.source_count){
+                return fmt::format("{}({}{})", destination, mnemonic(instruction.opcode),
+                                   sources(instruction));
+            }
+            return fmt::format("{}({}, {}{})", destination, register_name(instruction.sources[0]),
+                               mnemonic(instruction.opcode), sources(instruction, 1));
+        case RegisterOp::TEST:
+            return fmt::format("{} ({}, {}{}) goto I{}",
+                               (0 != (instruction.flags & INVERT)) ? "unless" : "if",
+                               register_name(instruction.sources[0]),
+                               mnemonic(instruction.opcode), sources(instruction, 1),
+                               instruction.target);
+        case RegisterOp::OPERATE:
+            break;
+    }
+
+    std::string name = mnemonic(instruction.opcode);
+    if(Opcode::DEFINE_FIELD == instruction.opcode
+       || Opcode::SAVE_FIELD_DEFINITION == instruction.opcode
+       || Opcode::RESTORE_FIELD_DEFINITION == instruction.opcode){
+        name += field_name(instruction.field);
+    }
+    std::string text = fmt::format("{}({}{})", destination, name, sources(instruction));
+    if(Opcode::SWITCH == instruction.opcode){
+        text += fmt::format(" of {} cases", instruction.value);
+    }
+    if(NO_INDEX != instruction.target){
+        text += fmt::format(" goto I{}", instruction.target);
+    }
+    if(NO_INDEX != instruction.alternate){
+        text += fmt::format(" else I{}", instruction.alternate);
+    }
+    return text;
+}
+
+// endregion: Listing
+
+} // end anonymous namespace
+
+RegisterProgram to_registers(const Program &program){
+    RegisterProgram registers;
+    Translator translator(program, registers);
+    auto count = static_cast<std::uint32_t>(program.instructions.size());
+    registers.starts.reserve(count + 1);
+    for(std::uint32_t i = 0; i < count; i++){
+        registers.starts.push_back(static_cast<std::uint32_t>(registers.instructions.size()));
+        translator.translate(i);
+    }
+    registers.starts.push_back(static_cast<std::uint32_t>(registers.instructions.size()));
+    return registers;
+}
+
+std::size_t optimize_registers(const Program &program, RegisterProgram &registers){
+    std::vector<bool> entries = entry_points(program);
+    Optimizer optimizer(registers);
+    std::uint32_t begin = 0;
+    for(std::uint32_t i = 1; i <= program.instructions.size(); i++){
+        if(i == program.instructions.size() || entries[i]){
+            optimizer.optimize(registers.starts[begin], registers.starts[i]);
+            begin = i;
+        }
+    }
+    return optimizer.compact();
+}
+
+std::size_t simplify_instructions(Program &program){
+    std::vector<bool> entries = entry_points(program);
+    Simplifier simplifier(program);
+    auto count = static_cast<std::uint32_t>(program.instructions.size());
+    std::uint32_t begin = 0;
+    for(std::uint32_t i = 1; i <= count; i++){
+        if(i == count || entries[i]){
+            simplifier.simplify(begin, i);
+            begin = i;
+        }
+    }
+    const std::vector<bool> &dropped = simplifier.dropped();
+    if(std::find(dropped.begin(), dropped.end(), true) != dropped.end()){
+        remove_instructions(program, dropped);
+    }
+    return simplifier.changed();
+}
+
+std::string listing(const Program &program, const RegisterProgram &original,
+                    const RegisterProgram &optimized){
+    std::string text;
+    auto count = static_cast<std::uint32_t>(program.instructions.size());
+    for(std::uint32_t line = 0; line < program.lines.size(); line++){
+        std::uint32_t first = program.lines[line].first;
+        std::uint32_t end = (line + 1 < program.lines.size()) ? program.lines[line + 1].first
+                                                               : count;
+        std::string_view label = program.label(program.lines[line]);
+        text += fmt::format("Line {} at {}:{}{}{}: {} -> {}\n", line, program.lines[line].row,
+                            program.lines[line].column, label.empty() ? "" : ", ", label,
+                            original.starts[end] - original.starts[first],
+                            optimized.starts[end] - optimized.starts[first]);
+        for(std::uint32_t index = first; index < end; index++){
+            std::string number = fmt::format("I{}", index);
+            for(std::uint32_t i = optimized.starts[index]; i < optimized.starts[index + 1]; i++){
+                text += fmt::format("    {:<8}{}\n", number,
+                                    format_instruction(optimized.instructions[i]));
+                number.clear();
+            }
+        }
+    }
+    text += fmt::format("{} instructions lowered, {} in registers, {} after optimization.\n",
+                        count, original.instructions.size(), optimized.instructions.size());
+    return text;
+}
+
+} // end namespace elsix
@@ -0,0 +1,152 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+/**
+ * @brief A register form of the lowered program, and a local optimizer over it.
+ *
+ * A lowered instruction such as `(S, A, XDB)` hides its work in its operands: the interpreter
+ * reads bug X, loads field D of the block it points to, loads field B of that block, and only
+ * then adds. The register form spells all of this out. Registers 0 through 25 are the bugs A
+ * through Z, and each value an instruction decodes, whether a literal, `T.`, or a field along a
+ * path, goes into a temporary register of its own, so that the instruction becomes
+ *
+ *     t0 = load D of X
+ *     t1 = load B of t0
+ *     S = (S, A, t1)
+ *
+ * Temporaries are written once and used only within a block, so they need no analysis of their
+ * own. Operations that reach the runtime, such as GT, PR, and the control operations, stay whole
+ * as OPERATE instructions with their operands in registers.
+ *
+ * The optimizer works on blocks that begin wherever control can enter other than from the
+ * instruction before (see `entry_points`) and run on through tests, which only leave. In each
+ * block it
+ *
+ *  - folds computations and tests whose operands are all constants, such as `(X, E, 5)`
+ *    followed by `(X, A, 3)`, which leaves X equal to 8;
+ *  - reuses a field already loaded through the same register, unless something that could
+ *    change storage has come between, so that `XDB` followed by `XDA` loads XD once;
+ *  - drops copies between temporaries, values nothing uses, stores to a bug that is stored to
+ *    again before anything reads it or control leaves, and stores to a field that is stored to
+ *    again before anything loads.
+ *
+ * Loads the verifier has not proven safe, stores, and divisions are kept even when their results
+ * are not used, since they may fault. A fault ends the program with a message and shows nothing
+ * of the bugs or of storage, so nothing else has to stay for it.
+ *
+ * The back ends execute or translate the lowered instructions, so `simplify_instructions` makes
+ * the same rewrites there, as far as instructions without temporaries can express them. A load
+ * is reused where an earlier instruction of the block copied the field to a bug, so that
+ * `(Y, E, XD)` followed by `(Z, E, XDB)` reads `YB`. `--dump-ir` lists the register form, with
+ * the number of instructions of each line before and after optimization.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "field.hpp"
+#include "program.hpp"
+
+namespace elsix{
+
+using Register = std::uint32_t;
+
+/// Registers below this are the bugs; the rest are temporaries.
+constexpr Register FIRST_TEMPORARY = BUG_NAME_COUNT;
+constexpr Register NO_REGISTER = 0xffffffff;
+
+enum class RegisterOp: std::uint8_t{
+    CONSTANT,   // destination = value
+    MOVE,       // destination = sources[0]
+    TIME,       // destination = T.
+    AVAILABLE,  // destination = n., with the order n in value
+    LOAD,       // destination = field `field` of the block at sources[0]
+    STORE,      // field `field` of the block at sources[0] = sources[1]
+    COMPUTE,    // destination = `opcode` of the sources: one if unary, three if a shift fills
+    TEST,       // Jump to `target` if the test `opcode` of the sources holds, as for `Instruction`.
+    OPERATE     // `opcode` as the runtime does it, with the operands in the sources.
+};
+
+/// Register instruction flags. The loads and stores the verifier has not proven safe are checked.
+constexpr std::uint8_t CHECKED = 0x02;
+
+struct RegisterInstruction{
+    RegisterOp op = RegisterOp::OPERATE;
+    Opcode opcode = Opcode::HALT;
+    // INVERT, for tests, and CHECKED.
+    std::uint8_t flags = 0;
+    // The field of a LOAD or STORE, of DEFINE_FIELD and the FD operations, or the bug of GT and GL.
+    std::uint8_t field = 0;
+    std::uint8_t source_count = 0;
+    Register destination = NO_REGISTER;
+    std::array<Register, 5> sources{};
+    Word value = 0;
+    // The index of the lowered instruction this comes from.
+    std::uint32_t source = 0;
+    std::uint32_t target = NO_INDEX;
+    std::uint32_t alternate = NO_INDEX;
+};
+
+struct RegisterProgram{
+    std::vector<RegisterInstruction> instructions;
+    // Instructions `starts[i]` up to `starts[i + 1]` come from instruction `i` of the program.
+    std::vector<std::uint32_t> starts;
+    std::uint32_t register_count = FIRST_TEMPORARY;
+};
+
+/// Translates the lowered program to registers. Superinstructions are taken apart.
+[[nodiscard]] RegisterProgram to_registers(const Program &program);
+
+/**
+ * @brief Runs the local optimizations over `registers`, the register form of `program`.
+ * @return The number of instructions removed.
+ */
+std::size_t optimize_registers(const Program &program, RegisterProgram &registers);
+
+/**
+ * @brief Folds constants, reuses loads, and drops dead stores in the lowered instructions of
+ * `program` block by block, as `optimize_registers` does in the register form. A test that
+ * always holds becomes a jump, and one that never does is dropped.
+ * @return The number of instructions changed or removed.
+ */
+std::size_t simplify_instructions(Program &program);
+
+/**
+ * @brief Lists `optimized` line by line, giving for each line the number of instructions it had
+ * in `original` and has in `optimized`, and the totals at the end.
+ */
+[[nodiscard]] std::string listing(const Program &program, const RegisterProgram &original,
+                                  const RegisterProgram &optimized);
+
+} // end namespace elsix
@@ -38,22 +38,15 @@
 
 namespace elsix{
 
-inline OperationData *lookup_op(std::string_view key, OperatorMap &map){
-    char op_code_chars[4] = "\0\0\0"; // NOLINT(hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
-    
-    // ToDo: This is stupid. We need a `char[4]`, but we have a `std::string_view`. Fortunately
-    //  we don't need a heep allocation.
-    for(int i = 0; i < key.size(); i++){
-        op_code_chars[i] = key[i];
-    }
-    auto found = map.find(op_code_chars);
+const OperationData *lookup_op(std::string_view key, const OperatorMap &map){
+    auto found = map.find(key);
     if(map.end() == found){
         return nullptr;
     }
     return &found->second;
 }
 
-inline NodeType lookup_keyword(std::string_view key){
+NodeType lookup_keyword(std::string_view key){
     auto found = keywords.find(key);
     if(found == keywords.end()){
         return NodeType::EMPTY;
@@ -86,14 +79,14 @@ KeywordMap keywords{ // NOLINT(cert-err58-cpp)
 // endregion: KeywordMap keywords
 
 // region: operators
-struct {
-    OperatorMap &binary;
-    OperatorMap &ternary;
-    OperatorMap &quaternary;
-} operators;
+
+/*
+ * The keys are made from the `name` literals, so the NUL padding of a name does not belong to its
+ * key: "GT\0" is the key "GT".
+ */
 
 // region: binary operators
-operators.binary = OperatorMap{{
+const OperatorMap binary_operators{{ // NOLINT(cert-err58-cpp)
     {   "GT\0",
        {   NodeType::GET_BLOCK,
            "GT\0",
@@ -102,12 +95,7 @@ operators.binary = OperatorMap{{
     {   "FR\0",
        {   NodeType::FREE_BLOCK,
            "FR\0",
-           {ArgType::C, ArgType::ZERO_CONST, ArgType::_, ArgType::_},
-           "Free block"}},
-    {   "FR\0",
-       {   NodeType::FREE_BLOCK,
-           "FR\0",
-           {ArgType::C, ArgType::C, ArgType::_, ArgType::_},
+           {ArgType::C, ArgType::CD, ArgType::_, ArgType::_},
            "Free block"}},
     {   "E\0\0",
        {   NodeType::SET_EQUAL,
@@ -403,11 +391,11 @@ operators.binary = OperatorMap{{
 // endregion: binary operators
 
 // region: ternary operators
-operators.ternary = OperatorMap{{
+const OperatorMap ternary_operators{{ // NOLINT(cert-err58-cpp)
     {   "SS\0",
         {   NodeType::SETUP_STORAGE,
             "SS\0",
-            {ArgType::S, ArgType::D, ArgType::S, ArgType::_},
+            {ArgType::D, ArgType::D, ArgType::D, ArgType::_},
             "Setup storage"}},
     {   "D\0\0",
         {   NodeType::DEFINE_FIELD,
@@ -459,7 +447,12 @@ operators.ternary = OperatorMap{{
 // endregion: ternary operators
 
 // region: quaternary operators
-operators.quaternay = {{
+const OperatorMap quaternary_operators{{ // NOLINT(cert-err58-cpp)
+    {   "GL\0",
+       {   NodeType::GET_CHAIN,
+           "GL\0",
+           {ArgType::C, ArgType::CD, ArgType::CD, ArgType::FIELD_NAME},
+           "Get a chain of blocks linked through a field"}},
     {   "DL\0",
        {   NodeType::DRAW_LINE,
            "DL\0",
@@ -491,37 +484,37 @@ operators.quaternay = {{
 
 // region: OperationMap tests
 
-OperatorMap tests{{
+const OperatorMap tests{{ // NOLINT(cert-err58-cpp)
     {   "E\0\0",
-      {   NodeType::SET_EQUAL,
+      {   NodeType::EQUALITY_TEST,
           "E\0\0",
           {ArgType::C, ArgType::CD, ArgType::_, ArgType::_},
-          "Set equal"}},
+          "Equality test"}},
     {   "EO\0",
-      {   NodeType::SET_EQUAL,
+      {   NodeType::EQUALITY_TEST,
           "EO\0",
           {ArgType::C, ArgType::O, ArgType::_, ArgType::_},
-          "Set equal"}},
+          "Equality test"}},
     {   "EH\0",
-      {   NodeType::SET_EQUAL,
+      {   NodeType::EQUALITY_TEST,
           "EH\0",
           {ArgType::C, ArgType::H, ArgType::_, ArgType::_},
-          "Set equal"}},
+          "Equality test"}},
     {   "N\0\0",
-      {   NodeType::LOGICAL_AND,
+      {   NodeType::INEQUALITY_TEST,
           "N\0\0",
           {ArgType::C, ArgType::CD, ArgType::_, ArgType::_},
-          "Logical AND"}},
+          "Inequality test"}},
     {   "NO\0",
       {   NodeType::INEQUALITY_TEST,
           "NO\0",
           {ArgType::C, ArgType::O, ArgType::_, ArgType::_},
           "Inequality test"}},
     {   "NH\0",
-      {   NodeType::LOGICAL_AND,
+      {   NodeType::INEQUALITY_TEST,
           "NH\0",
           {ArgType::C, ArgType::H, ArgType::_, ArgType::_},
-          "Logical AND"}},
+          "Inequality test"}},
     {   "G\0\0",
       {   NodeType::GREATER_TEST,
           "G\0\0",
@@ -595,34 +588,34 @@ OperatorMap tests{{
 // region: special_ops //Special cases.
 
 const std::array<OperationData, 7> special_ops{{  // NOLINT(cert-err58-cpp)
-   {{   NodeType::POINT_TO_SAME_AS,
+   {   NodeType::POINT_TO_SAME_AS,
         "P\0\0",
         {ArgType::C, ArgType::D, ArgType::_, ArgType::_},
-        "Make b Point to same as a"}},
-   {{   NodeType::DRAW_POINT,
+        "Make b Point to same as a"},
+   {   NodeType::DRAW_POINT,
         "DL\0",
         {ArgType::CD, ArgType::CD, ArgType::_, ArgType::_},
-        "Draw a point (a degenerate line)"}},
-   {{   NodeType::DRAW_LINE,
+        "Draw a point (a degenerate line)"},
+   {   NodeType::DRAW_LINE,
         "DL\0",
         {ArgType::CD, ArgType::CD, ArgType::CD, ArgType::CD},
-        "Draw a line"}},
-   {{   NodeType::DO,
+        "Draw a line"},
+   {   NodeType::DO,
         "DO\0",
         {ArgType::S, ArgType::_, ArgType::_, ArgType::_},
-        "Go to line or procedure"}},
-   {{   NodeType::DO_STATE,
+        "Go to line or procedure"},
+   {   NodeType::DO_STATE,
         "DO\0",
         {ArgType::STATE_CONST, ArgType::_, ArgType::_, ArgType::_},
-        "Go to print state procedure"}},
-   {{   NodeType::DO_DUMP,
+        "Go to print state procedure"},
+   {   NodeType::DO_DUMP,
         "DO\0",
         {ArgType::DUMP_CONST, ArgType::_, ArgType::_, ArgType::_},
-        "Go to print state and system dump procedure"}},
-   {{   NodeType::DO_ADVANCE,
+        "Go to print state and system dump procedure"},
+   {   NodeType::DO_ADVANCE,
         "DO\0",
         {ArgType::ADVANC_CONST, ArgType::_, ArgType::_, ArgType::_},
-        "Go to advance frame procedure"}}
+        "Go to advance frame procedure"}
 }};
 // endregion: special_ops //Special cases.
 
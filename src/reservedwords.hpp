@@ -39,6 +39,7 @@
 #include <array>
 #include <vector>
 #include <string>
+#include <string_view>
 #include "nodetypes.hpp"
 
 namespace elsix{
@@ -61,9 +62,7 @@ struct OperationData{
 //     {ArgType::_, ArgType::_, ArgType::_, ArgType::_},
 //     "A thing to test the stuff"
 // };
-using OperatorMap  = std::unordered_map<
-    char[4], OperationData
->; // NOLINT(hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+using OperatorMap  = std::unordered_map<std::string_view, OperationData>;
 using KeywordMap  = std::unordered_map<std::string_view, NodeType>;
 
 /**
@@ -76,13 +75,16 @@ extern KeywordMap keywords;
 NodeType lookup_keyword(std::string_view key);
 
 /**
- * @brief Database of operator information, where operator `name` is the lookup key.
- *
- *
+ * @brief Databases of operator information, where operator `name` is the lookup key.
  *
+ * An op code can mean different operations depending on how many arguments it is given, so there
+ * is a database for each number of arguments: `(a, op, b)`, `(a, op, b, c)`, and
+ * `(a, op, b, c, d)`.
  */
-extern OperatorMap operators;
-OperationData *lookup_op(std::string_view key, OperatorMap &map);
+extern const OperatorMap binary_operators;
+extern const OperatorMap ternary_operators;
+extern const OperatorMap quaternary_operators;
+const OperationData *lookup_op(std::string_view key, const OperatorMap &map);
 
 /**
  * @brief Test operation tokens.
@@ -91,7 +93,7 @@ OperationData *lookup_op(std::string_view key, OperatorMap &map);
  * occur immediately after a keyword (an IF expression).
  *
  */
-extern OperatorMap tests;
+extern const OperatorMap tests;
 
 /**
  * @brief An array holding operators that are special cases.
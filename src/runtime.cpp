@@ -0,0 +1,484 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+
+#include "fmt/format.h"
+
+#include "runtime.hpp"
+#include "conversion.hpp"
+#include "printlist.hpp"
+
+namespace elsix{
+
+Runtime::Runtime(const RuntimeOptions &options)
+    : clock(options.clock_mode),
+      first_card_(options.first_card),
+      printer_(options.print_fd, PRINT_COLUMNS, false),
+      microfilm_prefix_(options.microfilm_prefix),
+      microfilm_format_(options.microfilm_format),
+      copy_on_write_(options.copy_on_write),
+      detect_cycles_(options.detect_cycles),
+      pinned_regions_(options.pinned_regions){
+    // A deck named on the command line is opened now, so that one that cannot be read fails
+    // before the program starts. Standard input is read only if the program reads input, since
+    // reading it waits for the end of the file.
+    if(nullptr != options.input_path){
+        if(!input_.open(options.input_path)){
+            fault(fmt::format("Cannot read the input deck {}.", options.input_path));
+        }
+        input_open_ = true;
+        seek_first_card_();
+    }
+    if(options.punch_fd >= 0 && CardFormat::TEXT == options.punch_format){
+        punch_ = std::make_unique<CardWriter>(options.punch_fd, CARD_COLUMNS, true);
+    } else if(options.punch_fd >= 0){
+        binary_punch_ = std::make_unique<BinaryPunch>(options.punch_format);
+        if(!binary_punch_->open_descriptor(options.punch_fd)){
+            fault("Cannot punch a binary deck into the punch file.");
+        }
+    }
+    storage.set_copy_on_write(options.copy_on_write);
+    if(options.asynchronous_output){
+        printer_.set_asynchronous(true);
+        if(nullptr != punch_){
+            punch_->set_asynchronous(true);
+        }
+    }
+}
+
+Runtime::~Runtime(){
+    finish();
+}
+
+void Runtime::fault(const std::string &message){
+    throw RuntimeFault(message);
+}
+
+void Runtime::access_fault_(unsigned field, Word address) const{
+    if(!defined(field)){
+        fault(fmt::format("Field {} is used before it is defined.", field_name(field)));
+    }
+    if(0 == address){
+        fault(fmt::format("Field {} of a null pointer.", field_name(field)));
+    }
+    if(nullptr != storage.resolve(address)){
+        fault(fmt::format("Field {} of {:o} lies beyond the end of the block.", field_name(field),
+                          address));
+    }
+    if(storage.contains(address)){
+        fault(fmt::format("Field {} of {:o}, which is not a block.", field_name(field), address));
+    }
+    fault(fmt::format("Field {} of {:o}, which is not in storage.", field_name(field), address));
+}
+
+// region: Storage and fields
+
+void Runtime::setup_storage(Word first_word, Word max_order, Word last_word){
+    if(max_order > MAX_BLOCK_ORDER || last_word < first_word){
+        fault(fmt::format("Cannot set up storage from {:o} to {:o} for blocks of order {}.",
+                          first_word, last_word, max_order));
+    }
+    std::size_t region = storage.setup(first_word, static_cast<unsigned>(max_order), last_word);
+    for(unsigned bug = 0; bug < BUG_COUNT; bug++){
+        Word pinned = pinned_regions_[bug];
+        if(0 != pinned && storage.region(region).first_word() == pinned){
+            storage.pin_bug(bug, region);
+        }
+    }
+}
+
+void Runtime::define_field(unsigned field, Word word, Word first_bit, Word last_bit){
+    if(word > 0xffff || first_bit > 0xffff || last_bit > 0xffff
+       || !FieldDefinition::valid(static_cast<unsigned>(first_bit),
+                                  static_cast<unsigned>(last_bit))){
+        fault(fmt::format("Cannot define field {} as bits {} through {} of word {}.",
+                          field_name(field), first_bit, last_bit, word));
+    }
+    fields_[field] = FieldDefinition(static_cast<unsigned>(word), static_cast<unsigned>(first_bit),
+                                     static_cast<unsigned>(last_bit));
+    defined_fields_ |= Word{1} << field;
+}
+
+Word Runtime::get_block(unsigned bug, Word order){
+    Word block = (order > MAX_BLOCK_ORDER)
+                 ? 0 : storage.get_block_for_bug(bug, static_cast<unsigned>(order));
+    if(0 == block){
+        fault(fmt::format("No block of order {} is available.", order));
+    }
+    return block;
+}
+
+Word Runtime::get_chain(unsigned bug, Word order, Word count, Word fields){
+    unsigned link = static_cast<unsigned>(fields & 0xff) - 1;
+    unsigned back_link = static_cast<unsigned>((fields >> 8) & 0xff) - 1;
+    if(link >= FIELD_COUNT || !defined(link) || (back_link < FIELD_COUNT && !defined(back_link))){
+        fault("Get Chain links the blocks through a field that is not defined.");
+    }
+    if(order <= MAX_BLOCK_ORDER
+       && (fields_[link].extent() > (Word{1} << order)
+           || (back_link < FIELD_COUNT && fields_[back_link].extent() > (Word{1} << order)))){
+        fault("Get Chain links the blocks through a field beyond the end of a block.");
+    }
+    if(0 == count){
+        return 0;
+    }
+    Word chain = (order > MAX_BLOCK_ORDER) ? 0
+                 : storage.get_chain(bug, static_cast<unsigned>(order), count, fields_[link],
+                                     (back_link < FIELD_COUNT) ? &fields_[back_link] : nullptr);
+    if(0 == chain){
+        fault(fmt::format("No chain of {} blocks of order {} is available.", count, order));
+    }
+    return chain;
+}
+
+void Runtime::free_block(Word address){
+    if(!storage.is_block(address)){
+        fault(fmt::format("Free Block of {:o}, which is not a block.", address));
+    }
+    storage.free_block(address);
+}
+
+Word Runtime::duplicate_block(Word address){
+    if(!storage.is_block(address)){
+        fault(fmt::format("Duplicate Block of {:o}, which is not a block.", address));
+    }
+    Word duplicate = storage.duplicate_block(address);
+    if(0 == duplicate){
+        fault("No block is available for Duplicate Block.");
+    }
+    return duplicate;
+}
+
+Word Runtime::divide(Word dividend, Word divisor){
+    if(0 == divisor){
+        fault("Division by zero.");
+    }
+    return dividend / divisor;
+}
+
+void Runtime::save_contents(Word value){
+    contents_stack_.push_back(value);
+}
+
+Word Runtime::restore_contents(){
+    if(contents_stack_.empty()){
+        fault("Restore Field Contents with nothing saved.");
+    }
+    Word value = contents_stack_.back();
+    contents_stack_.pop_back();
+    return value;
+}
+
+void Runtime::save_definition(unsigned field){
+    definition_stacks_[field].push_back({fields_[field], defined(field)});
+}
+
+void Runtime::restore_definition(unsigned field){
+    auto &stack = definition_stacks_[field];
+    if(stack.empty()){
+        fault(fmt::format("Restore Field Definition of {} with nothing saved.", field_name(field)));
+    }
+    fields_[field] = stack.back().definition;
+    if(stack.back().defined){
+        defined_fields_ |= Word{1} << field;
+    } else{
+        defined_fields_ &= ~(Word{1} << field);
+    }
+    stack.pop_back();
+}
+
+// endregion: Storage and fields
+
+// region: Input and output
+
+void Runtime::seek_first_card_(){
+    if(0 != first_card_ && !input_.seek_card(first_card_)){
+        fault(fmt::format("The input deck has {} cards, so it has no card {}.",
+                          input_.card_count(), first_card_));
+    }
+}
+
+Word Runtime::input(Word columns){
+    if(!input_open_){
+        input_open_ = input_.open_descriptor(0);
+        if(input_open_){
+            seek_first_card_();
+        }
+    }
+    return input_.read(static_cast<unsigned>(std::min<Word>(columns, CARD_COLUMNS)));
+}
+
+void Runtime::print(Word count, Word characters) noexcept{
+    printer_.write(characters, static_cast<unsigned>(std::min<Word>(count, CHARACTERS_PER_WORD)));
+}
+
+void Runtime::punch(Word count, Word characters) noexcept{
+    auto columns = static_cast<unsigned>(std::min<Word>(count, CHARACTERS_PER_WORD));
+    if(nullptr != punch_){
+        punch_->write(characters, columns);
+    } else if(nullptr != binary_punch_){
+        binary_punch_->write(characters, columns);
+    }
+}
+
+void Runtime::print_list(Word first, unsigned field, Word words){
+    if(!defined(field)){
+        fault(fmt::format("Print List through field {}, which is not defined.", field_name(field)));
+    }
+    auto shown = static_cast<unsigned>(std::min<Word>(words, Word{1} << MAX_BLOCK_ORDER));
+    PrintListResult result = elsix::print_list(storage, printer_, first, fields_[field], shown,
+                                               detect_cycles_);
+    if(ListEnd::CYCLE == result.end){
+        // The blocks printed come first.
+        printer_.flush();
+        std::cerr << fmt::format("Print List of {:o} through field {} looped back on itself after "
+                                 "{} blocks.", first, field_name(field), result.blocks)
+                  << std::endl;
+    }
+}
+
+Microfilm &Runtime::film_(){
+    if(nullptr == microfilm_){
+        microfilm_ = std::make_unique<Microfilm>(microfilm_prefix_, microfilm_format_);
+    }
+    return *microfilm_;
+}
+
+void Runtime::x_range(Word minimum, Word maximum){
+    film_().set_x_range(minimum, maximum);
+}
+
+void Runtime::y_range(Word minimum, Word maximum){
+    film_().set_y_range(minimum, maximum);
+}
+
+void Runtime::draw(Word x0, Word y0, Word x1, Word y1){
+    film_().draw_line(x0, y0, x1, y1);
+}
+
+void Runtime::draw(Word x, Word y){
+    film_().draw_point(x, y);
+}
+
+void Runtime::type(Word x, Word y, Word characters, Word count, bool vertical){
+    film_().type(x, y, characters,
+                      static_cast<unsigned>(std::min<Word>(count, CHARACTERS_PER_WORD)), vertical);
+}
+
+void Runtime::advance(){
+    if(!film_().advance()){
+        fault("Cannot write a microfilm frame.");
+    }
+}
+
+void Runtime::print_octal_(Word value){
+    printer_.write(DEFAULT_CHARACTERS.blank, 1);
+    printer_.write(binary_to_octal(value >> 60), 2);
+    printer_.write(binary_to_octal(value >> 30), CONVERSION_DIGITS);
+    printer_.write(binary_to_octal(value), CONVERSION_DIGITS);
+}
+
+void Runtime::print_definitions_(){
+    for(unsigned field = 0; field < FIELD_COUNT; field++){
+        if(!defined(field)){
+            continue;
+        }
+        const FieldDefinition &definition = fields_[field];
+        char name = field_name(field);
+        printer_.write(encode_hollerith(std::string_view(&name, 1)), 1);
+        print_octal_(definition.word);
+        print_octal_(WORD_BITS - definition.shift - definition.width
+                     + (FieldLayout::STRADDLING == definition.layout ? WORD_BITS : 0));
+        print_octal_(definition.width);
+        printer_.end_line();
+    }
+}
+
+void Runtime::state(){
+    for(unsigned bug = 0; bug < BUG_NAME_COUNT; bug++){
+        char name = field_name(bug + 10);
+        printer_.write(encode_hollerith(std::string_view(&name, 1)), 1);
+        print_octal_(bugs[bug]);
+        printer_.end_line();
+    }
+    print_definitions_();
+}
+
+void Runtime::dump(){
+    state();
+    for(std::size_t region = 0; region < storage.region_count(); region++){
+        const StorageStatistics &statistics = storage.statistics(region);
+        print_octal_(storage.region(region).first_word());
+        print_octal_(storage.region(region).end_word());
+        print_octal_(statistics.blocks_gotten - statistics.blocks_freed);
+        printer_.end_line();
+    }
+}
+
+void Runtime::finish() noexcept{
+    printer_.flush();
+    std::chrono::nanoseconds blocked = printer_.blocked_time();
+    if(nullptr != punch_){
+        punch_->flush();
+        blocked += punch_->blocked_time();
+    }
+    if(nullptr != binary_punch_ && !binary_punch_->close()){
+        std::cerr << "Punching failed, so the punch file is incomplete." << std::endl;
+    }
+    if(printer_.asynchronous()){
+        std::cerr << fmt::format("Waited {:.3f} ms for output.",
+                                 std::chrono::duration<double, std::milli>(blocked).count())
+                  << std::endl;
+    }
+    if(copy_on_write_){
+        // Regions replaced by a later Setup Storage took their counts with them.
+        StorageStatistics total;
+        for(std::size_t region = 0; region < storage.region_count(); region++){
+            const StorageStatistics &statistics = storage.statistics(region);
+            total.duplicates += statistics.duplicates;
+            total.shared_duplicates += statistics.shared_duplicates;
+            total.deferred_copies += statistics.deferred_copies;
+            total.words_copied += statistics.words_copied;
+        }
+        std::cerr << fmt::format("Duplicated {} blocks, {} copy-on-write, and made {} deferred "
+                                 "copies, copying {} words in all.", total.duplicates,
+                                 total.shared_duplicates, total.deferred_copies,
+                                 total.words_copied)
+                  << std::endl;
+    }
+}
+
+// endregion: Input and output
+
+int parse_runtime_option(int argc, char **argv, int &i, RuntimeOptions &options){
+    if(0 == std::strcmp(argv[i], "--deterministic")){
+        options.clock_mode = ClockMode::DETERMINISTIC;
+        return 1;
+    }
+    if(0 == std::strcmp(argv[i], "--punch") && i + 1 < argc){
+        // Readable as well, as a binary deck is punched through a mapping.
+        options.punch_fd = ::open(argv[++i], O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if(options.punch_fd < 0){
+            std::cerr << "Cannot create the punch file " << argv[i] << std::endl;
+            return -1;
+        }
+        return 1;
+    }
+    if(0 == std::strncmp(argv[i], "--punch-format=", 15)){
+        const char *format = argv[i] + 15;
+        if(0 == std::strcmp(format, "text")){
+            options.punch_format = CardFormat::TEXT;
+        } else if(0 == std::strcmp(format, "codes")){
+            options.punch_format = CardFormat::CODES;
+        } else if(0 == std::strcmp(format, "column-binary")){
+            options.punch_format = CardFormat::COLUMN_BINARY;
+        } else{
+            std::cerr << "The punch format is text, codes, or column-binary." << std::endl;
+            return -1;
+        }
+        return 1;
+    }
+    if(0 == std::strcmp(argv[i], "--asynchronous-output")){
+        options.asynchronous_output = true;
+        return 1;
+    }
+    if(0 == std::strcmp(argv[i], "--copy-on-write")){
+        options.copy_on_write = true;
+        return 1;
+    }
+    if(0 == std::strcmp(argv[i], "--detect-cycles")){
+        options.detect_cycles = true;
+        return 1;
+    }
+    if(0 == std::strcmp(argv[i], "--pin-bug") && i + 1 < argc){
+        // X=address, the address in octal as Setup Storage is usually written.
+        const char *pin = argv[++i];
+        char *end = nullptr;
+        Word first_word = ('A' <= pin[0] && 'Z' >= pin[0] && '=' == pin[1])
+                          ? std::strtoull(pin + 2 + ('*' == pin[2]), &end, 8) : 0;
+        if(nullptr == end || '\0' != *end || 0 == first_word){
+            std::cerr << "Pin a bug to a region as --pin-bug X=20000000, giving the region's "
+                         "first word in octal." << std::endl;
+            return -1;
+        }
+        options.pinned_regions[pin[0] - 'A'] = first_word;
+        return 1;
+    }
+    if(0 == std::strcmp(argv[i], "--first-card") && i + 1 < argc){
+        const char *card = argv[++i];
+        char *end = nullptr;
+        options.first_card = std::strtoull(card, &end, 10);
+        if(end == card || '\0' != *end){
+            std::cerr << "Give the first card to read as --first-card n, counting from 0."
+                      << std::endl;
+            return -1;
+        }
+        return 1;
+    }
+    return 0;
+}
+
+int run_protected(const RuntimeOptions &options, const std::function<int(Runtime &)> &body){
+    try{
+        Runtime runtime(options);
+        runtime.clock.start();
+        return body(runtime);
+    } catch(const RuntimeFault &fault){
+        std::cerr << "Runtime fault: " << fault.what() << std::endl;
+        return EXIT_FAULT;
+    }
+}
+
+int run_compiled(int argc, char **argv, CompiledProgram program){
+    RuntimeOptions options;
+    for(int i = 1; i < argc; i++){
+        int parsed = parse_runtime_option(argc, argv, i, options);
+        if(parsed < 0){
+            return EXIT_FAULT;
+        }
+        if(0 == parsed && 0 == std::strncmp(argv[i], "--", 2)){
+            std::cerr << "Unknown option " << argv[i] << std::endl;
+            return EXIT_FAULT;
+        }
+        if(0 == parsed){
+            options.input_path = argv[i];
+        }
+    }
+    return run_protected(options, program);
+}
+
+} // end namespace elsix
@@ -0,0 +1,358 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The state of a running L6 program and the operations on it that are too large to
+ * expand inline.
+ *
+ * Every back end executes programs against a `Runtime`: the interpreter, and native programs
+ * produced by the transpiler, which link against the runtime library `elsixrt`. Reading and
+ * writing a field is inline here, so that compiled code reduces it to a check, a load, a shift,
+ * and a mask.
+ *
+ * A program that does something impossible, such as following a null pointer or using a field
+ * that was never defined, raises a `RuntimeFault`, which ends the program with a message naming
+ * what went wrong.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "field.hpp"
+#include "program.hpp"
+#include "storage.hpp"
+#include "cardio.hpp"
+#include "binarypunch.hpp"
+#include "clock.hpp"
+#include "microfilm.hpp"
+
+namespace elsix{
+
+class RuntimeFault: public std::runtime_error{
+public:
+    explicit RuntimeFault(const std::string &message) : std::runtime_error(message){
+    }
+};
+
+struct RuntimeOptions{
+    ClockMode clock_mode = ClockMode::REAL_TIME;
+    /// The input deck, or null for standard input.
+    const char *input_path = nullptr;
+    /// The card, counting from 0, that the first Input reads from; see `CardReader::seek_card()`.
+    std::size_t first_card = 0;
+    int print_fd = 1;
+    /// Punched cards are discarded if this is negative.
+    int punch_fd = -1;
+    /// Cards are punched as lines of text, or into a binary deck (see cardformat.hpp), in which
+    /// case `punch_fd` must be a regular file open for reading and writing.
+    CardFormat punch_format = CardFormat::TEXT;
+    /// Printing and punching hand full buffers to a thread that writes them; see
+    /// `CardWriter::set_asynchronous()`. The time spent waiting for it is reported at the end.
+    bool asynchronous_output = false;
+    /// Duplicate Block shares the contents of the duplicate with the original until either is
+    /// written; see `StorageRegion`. How much copying that saved is reported at the end.
+    bool copy_on_write = false;
+    /// Print List stops at a list that loops back on itself and reports it on standard error.
+    bool detect_cycles = false;
+    /// For each bug, the first word of the region that blocks gotten through it come from while
+    /// that region can supply them, or 0 to take them from the first region that can. The pin
+    /// takes effect when Setup Storage sets up a region beginning at that word.
+    std::array<Word, BUG_COUNT> pinned_regions{};
+    std::string microfilm_prefix = "frame";
+    MicrofilmFormat microfilm_format = MicrofilmFormat::PNG;
+};
+
+/// The exit status of a program that ended by DONE, and of one that ended by FAIL.
+constexpr int EXIT_DONE = 0;
+constexpr int EXIT_FAIL = 1;
+/// The exit status of a program that ended with a runtime fault.
+constexpr int EXIT_FAULT = 2;
+
+class Runtime{
+public:
+    explicit Runtime(const RuntimeOptions &options = RuntimeOptions());
+    ~Runtime();
+    Runtime(const Runtime &) = delete;
+    Runtime &operator=(const Runtime &) = delete;
+
+    std::array<Word, BUG_NAME_COUNT> bugs{};
+    ProgramClock clock;
+    StorageManager storage;
+    /// The return points of the subroutines being executed, innermost last.
+    std::vector<std::uint32_t> calls;
+
+    [[noreturn]] static void fault(const std::string &message);
+
+    // region: Fields
+
+    [[nodiscard]] bool defined(unsigned field) const noexcept{
+        return 0 != (defined_fields_ & (Word{1} << field));
+    }
+
+    [[nodiscard]] const FieldDefinition &field(unsigned field) const noexcept{
+        return fields_[field];
+    }
+
+    /// Field `field` of the block at `address`.
+    [[nodiscard]] Word load(unsigned field, Word address) const{
+        return fields_[field].load(block_(field, address));
+    }
+
+    void store(unsigned field, Word address, Word value){
+        fields_[field].store(block_for_write_(field, address), value);
+    }
+
+    /**
+     * @brief As `load`, but without checking that the address is that of a block that reaches
+     * the field and that the field is defined, for an access the verifier has proven safe.
+     */
+    [[nodiscard]] Word load_unchecked(unsigned field, Word address) const noexcept{
+        return fields_[field].load(storage.resolve(address));
+    }
+
+    void store_unchecked(unsigned field, Word address, Word value){
+        fields_[field].store(storage.resolve_for_write(address), value);
+    }
+
+    /**
+     * @brief Field `field` of the block at `address`, where the field is known to be defined as
+     * a field within one word with the given word, shift, and mask wherever the read happens.
+     * The definition is not looked up, so the read is a check, a load, a shift, and a mask, or
+     * only the last three if the address need not be `CHECKED`.
+     */
+    template<Word WORD, unsigned SHIFT, Word MASK, bool CHECKED = true>
+    [[nodiscard]] Word load_constant(unsigned field, Word address) const{
+        const Word *block = storage.resolve(address);
+        if(CHECKED && (nullptr == block || 0 == address || storage.block_words(address) <= WORD)){
+            access_fault_(field, address);
+        }
+        return (block[WORD] >> SHIFT) & MASK;
+    }
+
+    template<Word WORD, unsigned SHIFT, Word MASK, bool CHECKED = true>
+    void store_constant(unsigned field, Word address, Word value){
+        Word *block = storage.resolve_for_write(address);
+        if(CHECKED && (nullptr == block || 0 == address || storage.block_words(address) <= WORD)){
+            access_fault_(field, address);
+        }
+        block[WORD] = (block[WORD] & ~(MASK << SHIFT)) | ((value & MASK) << SHIFT);
+    }
+
+    // endregion: Fields
+
+    // region: Operations
+
+    void setup_storage(Word first_word, Word max_order, Word last_word);
+    void define_field(unsigned field, Word word, Word first_bit, Word last_bit);
+    [[nodiscard]] Word get_block(unsigned bug, Word order);
+    /// `fields` holds the link field index plus one, and the back link field index plus one
+    /// shifted left eight bits, or zero for none.
+    [[nodiscard]] Word get_chain(unsigned bug, Word order, Word count, Word fields);
+    void free_block(Word address);
+    [[nodiscard]] Word duplicate_block(Word address);
+    [[nodiscard]] static Word divide(Word dividend, Word divisor);
+
+    [[nodiscard]] Word input(Word columns);
+    void print(Word count, Word characters) noexcept;
+    void punch(Word count, Word characters) noexcept;
+    void print_list(Word first, unsigned field, Word words);
+
+    void x_range(Word minimum, Word maximum);
+    void y_range(Word minimum, Word maximum);
+    void draw(Word x0, Word y0, Word x1, Word y1);
+    void draw(Word x, Word y);
+    void type(Word x, Word y, Word characters, Word count, bool vertical);
+    /// `(DO, ADVANC)`.
+    void advance();
+    /// `(DO, DUMP)`: prints the bugs, the field definitions, and the blocks in use.
+    void dump();
+    /// `(DO, STATE)`: prints the bugs and the field definitions.
+    void state();
+
+    void save_contents(Word value);
+    [[nodiscard]] Word restore_contents();
+    void save_definition(unsigned field);
+    void restore_definition(unsigned field);
+
+    /// `T.`
+    [[nodiscard]] Word time() const noexcept{
+        return clock.milliseconds();
+    }
+
+    /// `n.`
+    [[nodiscard]] Word available(Word order) const noexcept{
+        return storage.available_blocks(static_cast<unsigned>(order));
+    }
+
+    /// Writes out all output and closes a binary punch deck. With asynchronous output it reports
+    /// on standard error how long the program waited for it, and with copy-on-write how much
+    /// Duplicate Block copied. Called when the program ends.
+    void finish() noexcept;
+
+    // endregion: Operations
+
+private:
+    std::array<FieldDefinition, FIELD_COUNT> fields_{};
+    // Bit `f` is set once field `f` has been defined.
+    Word defined_fields_ = 0;
+
+    CardReader input_;
+    bool input_open_ = false;
+    std::size_t first_card_;
+    CardWriter printer_;
+    std::unique_ptr<CardWriter> punch_;
+    std::unique_ptr<BinaryPunch> binary_punch_;
+    std::unique_ptr<Microfilm> microfilm_;
+    std::string microfilm_prefix_;
+    MicrofilmFormat microfilm_format_;
+    bool copy_on_write_;
+    bool detect_cycles_;
+    std::array<Word, BUG_COUNT> pinned_regions_;
+
+    std::vector<Word> contents_stack_;
+    // A definition is saved with whether the field was defined.
+    struct SavedDefinition{
+        FieldDefinition definition;
+        bool defined;
+    };
+    std::array<std::vector<SavedDefinition>, FIELD_COUNT> definition_stacks_;
+
+    [[nodiscard]] const Word *block_(unsigned field, Word address) const{
+        const Word *block = storage.resolve(address);
+        if(nullptr == block || 0 == address || !defined(field)
+           || storage.block_words(address) < fields_[field].extent()){
+            access_fault_(field, address);
+        }
+        return block;
+    }
+
+    [[nodiscard]] Word *block_for_write_(unsigned field, Word address){
+        Word *block = storage.resolve_for_write(address);
+        if(nullptr == block || 0 == address || !defined(field)
+           || storage.block_words(address) < fields_[field].extent()){
+            access_fault_(field, address);
+        }
+        return block;
+    }
+
+    [[noreturn]] void access_fault_(unsigned field, Word address) const;
+    /// Moves the newly opened input deck to the first card to be read.
+    void seek_first_card_();
+    Microfilm &film_();
+    void print_octal_(Word value);
+    void print_definitions_();
+};
+
+// region: Bit operations shared by the back ends
+
+/// Shifts of a word or more leave nothing.
+constexpr Word shift_left(Word value, Word amount) noexcept{
+    return (amount >= WORD_BITS) ? 0 : value << amount;
+}
+
+constexpr Word shift_right(Word value, Word amount) noexcept{
+    return (amount >= WORD_BITS) ? 0 : value >> amount;
+}
+
+/// `(a, L, cd, co)`: `a` shifted left by `cd`, with the bits vacated filled from the low order
+/// bits of `co`, as digits are appended to a number read a character at a time.
+constexpr Word shift_left_filling(Word value, Word amount, Word fill) noexcept{
+    return (amount >= WORD_BITS) ? fill
+                                 : shift_left(value, amount) | (fill & ((Word{1} << amount) - 1));
+}
+
+/// `(a, R, cd, co)`: `a` shifted right by `cd`, with the bits vacated filled from the low order
+/// bits of `co`.
+constexpr Word shift_right_filling(Word value, Word amount, Word fill) noexcept{
+    return (amount >= WORD_BITS)
+           ? fill : shift_right(value, amount) | shift_left(fill, WORD_BITS - amount);
+}
+
+/// `(a, LO, c)`: the number of zero bits to the left of the leftmost one bit.
+constexpr Word left_one(Word value) noexcept{
+    return (0 == value) ? WORD_BITS : static_cast<Word>(__builtin_clzll(value));
+}
+
+constexpr Word left_zero(Word value) noexcept{
+    return left_one(~value);
+}
+
+/// `(a, RO, c)`: the number of zero bits to the right of the rightmost one bit.
+constexpr Word right_one(Word value) noexcept{
+    return (0 == value) ? WORD_BITS : static_cast<Word>(__builtin_ctzll(value));
+}
+
+constexpr Word right_zero(Word value) noexcept{
+    return right_one(~value);
+}
+
+constexpr Word count_ones(Word value) noexcept{
+    return static_cast<Word>(__builtin_popcountll(value));
+}
+
+constexpr Word count_zeroes(Word value) noexcept{
+    return WORD_BITS - count_ones(value);
+}
+
+// endregion: Bit operations shared by the back ends
+
+/**
+ * @brief Recognizes the runtime's command line options at `argv[i]`: `--deterministic`,
+ * `--punch path`, `--punch-format=text|codes|column-binary`, `--asynchronous-output`,
+ * `--copy-on-write`, `--pin-bug X=address`, with the address in octal, `--first-card n`, and
+ * `--detect-cycles`.
+ * @return 1 if it consumed an option, advancing `i` past any argument, 0 if `argv[i]` is not a
+ * runtime option, and -1 if the option cannot be carried out.
+ */
+int parse_runtime_option(int argc, char **argv, int &i, RuntimeOptions &options);
+
+/**
+ * @brief Sets up a runtime and runs `body` in it, reporting a fault.
+ * @return What `body` returns, or `EXIT_FAULT`.
+ */
+int run_protected(const RuntimeOptions &options, const std::function<int(Runtime &)> &body);
+
+/// The body of a compiled program. Returns `EXIT_DONE` or `EXIT_FAIL`.
+using CompiledProgram = int (*)(Runtime &);
+
+/**
+ * @brief The `main` of a compiled program. The command line is the runtime's options followed by
+ * the input deck, if it is not standard input.
+ */
+int run_compiled(int argc, char **argv, CompiledProgram program);
+
+} // end namespace elsix
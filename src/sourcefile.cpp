@@ -57,7 +57,7 @@ SourceFile::SourceFile(const std::string &filename) : filename_(filename){
     // Seek to the end to get the size of the file.
     in_stream.seekg(0, std::ios::end);
     // Get the file size (offset of end).
-    size_t file_length = in_stream.tellg();
+    size_t file_length = in_stream ? static_cast<size_t>(in_stream.tellg()) : 0;
     // Return the input pointer to the beginning.
     in_stream.seekg(0, std::ios::beg);
     // Allocate enough memory for the file.
@@ -82,7 +82,7 @@ SourceFile::SourceFile(const std::string &filename) : filename_(filename){
             }
         }
         // Don't forget to add the last line in the case that the file does not end in '\n'.
-        if(!isNewline(buffer[file_length - 1])){
+        if(file_length > 0 && !isNewline(buffer[file_length - 1])){
             lines.emplace_back(buffer.get() + start, i - start);
         }
     }
@@ -102,7 +102,7 @@ SourceFile::SourceFile(const std::string &filename) : filename_(filename){
  * @param span: A span within the file.
  * @return: A `string_view` containing the text covered by the span.
  */
-inline std::string_view SourceFile::span_to_string(Span span) const noexcept{
+std::string_view SourceFile::span_to_string(Span span) const noexcept{
     const char *begin = lines[span.start.row].begin() + span.start.column;
     const char *end = lines[span.end.row].begin() + span.end.column;
     return std::string_view(begin, end - begin);
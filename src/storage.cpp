@@ -0,0 +1,178 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <cstring>
+
+#include "storage.hpp"
+
+namespace elsix{
+
+StorageManager::StorageManager(){
+    bug_regions_.fill(ANY_REGION);
+}
+
+std::size_t StorageManager::setup(Word first_word, unsigned max_order, Word last_word){
+    auto region = std::make_unique<StorageRegion>();
+    region->set_small_block_limit(small_block_limit_);
+    region->set_large_block_window(large_block_window_);
+    region->set_copy_on_write(copy_on_write_);
+    region->setup(first_word, max_order, last_word);
+
+    // Discard the regions the new one overlaps, adjusting pins to the surviving indices.
+    std::vector<std::unique_ptr<StorageRegion>> survivors;
+    std::vector<std::size_t> new_index(regions_.size(), ANY_REGION);
+    for(std::size_t i = 0; i < regions_.size(); i++){
+        if(regions_[i]->end_word() <= region->first_word()
+            || region->end_word() <= regions_[i]->first_word()){
+            new_index[i] = survivors.size();
+            survivors.push_back(std::move(regions_[i]));
+        }
+    }
+    for(std::size_t &pinned : bug_regions_){
+        if(ANY_REGION != pinned){
+            pinned = new_index[pinned];
+        }
+    }
+
+    regions_ = std::move(survivors);
+    regions_.push_back(std::move(region));
+    recent_region_ = regions_.back().get();
+    return regions_.size() - 1;
+}
+
+Word StorageManager::get_block(unsigned order){
+    return get_block_preferring_(ANY_REGION, order);
+}
+
+Word StorageManager::get_block_for_bug(unsigned bug, unsigned order){
+    return get_block_preferring_(bug_regions_[bug], order);
+}
+
+Word StorageManager::get_chain(unsigned bug, unsigned order, std::size_t count,
+                               const FieldDefinition &link, const FieldDefinition *back_link){
+    std::size_t pinned = bug_regions_[bug];
+    if(ANY_REGION != pinned){
+        Word head = regions_[pinned]->get_chain(order, count, link, back_link);
+        if(0 != head){
+            return head;
+        }
+    }
+    // The pinned region has already failed, and trying it again would count a second failure.
+    for(std::size_t region = 0; region < regions_.size(); region++){
+        if(region == pinned){
+            continue;
+        }
+        Word head = regions_[region]->get_chain(order, count, link, back_link);
+        if(0 != head){
+            return head;
+        }
+    }
+    return 0;
+}
+
+Word StorageManager::duplicate_block(Word source){
+    StorageRegion *source_region = region_of_(source);
+    if(nullptr == source_region || !source_region->is_block(source)){
+        return 0;
+    }
+    Word duplicate = source_region->duplicate_block(source);
+    if(0 != duplicate){
+        return duplicate;
+    }
+
+    // The source's region is full. Copy into another region; sharing cannot cross regions.
+    unsigned order = source_region->order_of(source);
+    for(auto &region : regions_){
+        if(region.get() == source_region){
+            continue;
+        }
+        duplicate = region->get_block(order);
+        if(0 != duplicate){
+            std::memcpy(region->resolve_for_write(duplicate), source_region->resolve(source),
+                        sizeof(Word) << order);
+            return duplicate;
+        }
+    }
+    return 0;
+}
+
+void StorageManager::free_block(Word address){
+    StorageRegion *region = region_of_(address);
+    if(nullptr != region){
+        region->free_block(address);
+    }
+}
+
+void StorageManager::set_copy_on_write(bool enabled) noexcept{
+    copy_on_write_ = enabled;
+    for(auto &region : regions_){
+        region->set_copy_on_write(enabled);
+    }
+}
+
+StorageRegion *StorageManager::find_region_(Word address) const noexcept{
+    for(const auto &region : regions_){
+        if(region->contains(address)){
+            recent_region_ = region.get();
+            return recent_region_;
+        }
+    }
+    return nullptr;
+}
+
+Word StorageManager::get_block_preferring_(std::size_t pinned, unsigned order){
+    if(ANY_REGION != pinned){
+        Word address = get_block_from_(pinned, order);
+        if(0 != address){
+            return address;
+        }
+    }
+    // First fit over the rest, skipping the pinned region as for a chain.
+    for(std::size_t region = 0; region < regions_.size(); region++){
+        if(region == pinned){
+            continue;
+        }
+        Word address = get_block_from_(region, order);
+        if(0 != address){
+            return address;
+        }
+    }
+    return 0;
+}
+
+Word StorageManager::get_block_from_(std::size_t region, unsigned order){
+    Word address = regions_[region]->get_block(order);
+    if(0 != address){
+        recent_region_ = regions_[region].get();
+    }
+    return address;
+}
+
+} // end namespace elsix
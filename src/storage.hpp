@@ -0,0 +1,197 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The storage manager, which implements Setup Storage, Get Block, and Free Block.
+ *
+ * A program may call Setup Storage more than once. Each call establishes a `StorageRegion` with
+ * its own allocators, size limits, and statistics. A Setup Storage that overlaps existing regions
+ * replaces them.
+ *
+ * By default Get Block takes a block from the first region, in the order the regions were set
+ * up, that can supply one. A bug may instead be pinned to a region, in which case blocks gotten
+ * through that bug come from that region whenever it can supply them. Keeping hot and cold data
+ * structures in different regions keeps them on different cache lines and pages.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+#include "field.hpp"
+#include "storageregion.hpp"
+
+namespace elsix{
+
+/// The number of bugs, `A` through `Z`.
+constexpr unsigned BUG_COUNT = 26;
+
+class StorageManager{
+public:
+    /// Marks a bug that is not pinned to a region.
+    static constexpr std::size_t ANY_REGION = static_cast<std::size_t>(-1);
+
+    StorageManager();
+    ~StorageManager() = default;
+
+    /**
+     * @brief Implements `(s1, SS, d, s2)`, adding a region. Existing regions that overlap the new
+     * one are discarded, and bugs pinned to them are unpinned.
+     * @return The index of the new region.
+     */
+    std::size_t setup(Word first_word, unsigned max_order, Word last_word);
+
+    /// Implements `(a, GT, cd)` with the first-fit region policy.
+    [[nodiscard]] Word get_block(unsigned order);
+
+    /// Implements `(a, GT, cd)` where `a` is, or is a remote field reached from, bug `bug`.
+    [[nodiscard]] Word get_block_for_bug(unsigned bug, unsigned order);
+
+    /// Implements `(a, GL, cd, n, f)`. See `StorageRegion::get_chain()`. The chain comes from a
+    /// single region.
+    [[nodiscard]] Word get_chain(unsigned bug, unsigned order, std::size_t count,
+                                 const FieldDefinition &link,
+                                 const FieldDefinition *back_link = nullptr);
+
+    /// Implements `(a, DP, c)`. The duplicate is made in the region of the source if possible.
+    [[nodiscard]] Word duplicate_block(Word source);
+
+    /// Implements `(a, FR, 0)`.
+    void free_block(Word address);
+
+    /// Blocks gotten through `bug` come from `region` while it can supply them.
+    void pin_bug(unsigned bug, std::size_t region) noexcept{
+        bug_regions_[bug] = region;
+    }
+
+    void unpin_bug(unsigned bug) noexcept{
+        bug_regions_[bug] = ANY_REGION;
+    }
+
+    // region: Configuration of subsequently set up regions
+
+    void set_small_block_limit(unsigned order) noexcept{
+        small_block_limit_ = order;
+    }
+
+    void set_large_block_window(Word words) noexcept{
+        large_block_window_ = words;
+    }
+
+    /// Applies to existing regions as well.
+    void set_copy_on_write(bool enabled) noexcept;
+
+    // endregion: Configuration of subsequently set up regions
+
+    [[nodiscard]] bool contains(Word address) const noexcept{
+        return nullptr != region_of_(address);
+    }
+
+    /// Is `address` the address of an allocated block?
+    [[nodiscard]] bool is_block(Word address) const noexcept{
+        const StorageRegion *region = region_of_(address);
+        return nullptr != region && region->is_block(address);
+    }
+
+    /// The order of the allocated block beginning at `address`.
+    [[nodiscard]] unsigned order_of(Word address) const noexcept{
+        return region_of_(address)->order_of(address);
+    }
+
+    /// The number of words a field access at `address`, which `resolve()` translates, may reach.
+    [[nodiscard]] Word block_words(Word address) const noexcept{
+        return region_of_(address)->block_words(address);
+    }
+
+    /// Translates the address of a block to the host address of its contents for reading, or
+    /// `nullptr` if the address is not in any region or is in a large block window but not that
+    /// of a large block.
+    [[nodiscard]] const Word *resolve(Word address) const noexcept{
+        const StorageRegion *region = region_of_(address);
+        return (nullptr == region) ? nullptr : region->resolve(address);
+    }
+
+    /// Translates the address of a block to the host address of its contents for writing, or
+    /// `nullptr` where `resolve()` is.
+    [[nodiscard]] Word *resolve_for_write(Word address){
+        StorageRegion *region = region_of_(address);
+        return (nullptr == region) ? nullptr : region->resolve_for_write(address);
+    }
+
+    /// Implements `n.`, over all regions. Each region keeps its count current, so this costs one
+    /// lookup per region.
+    [[nodiscard]] Word available_blocks(unsigned order) const noexcept{
+        Word blocks = 0;
+        for(const auto &region : regions_){
+            blocks += region->available_blocks(order);
+        }
+        return blocks;
+    }
+
+    [[nodiscard]] std::size_t region_count() const noexcept{
+        return regions_.size();
+    }
+
+    [[nodiscard]] const StorageRegion &region(std::size_t index) const noexcept{
+        return *regions_[index];
+    }
+
+    [[nodiscard]] const StorageStatistics &statistics(std::size_t region) const noexcept{
+        return regions_[region]->statistics();
+    }
+
+private:
+    std::vector<std::unique_ptr<StorageRegion>> regions_;
+    std::array<std::size_t, BUG_COUNT> bug_regions_;
+    // The region of the most recently translated address. Programs tend to work within one
+    // region for a while, and with a single region this is always the answer.
+    mutable StorageRegion *recent_region_ = nullptr;
+
+    unsigned small_block_limit_ = DEFAULT_SMALL_BLOCK_ORDER;
+    Word large_block_window_ = DEFAULT_LARGE_BLOCK_WINDOW;
+    bool copy_on_write_ = false;
+
+    [[nodiscard]] StorageRegion *region_of_(Word address) const noexcept{
+        if(nullptr != recent_region_ && recent_region_->contains(address)){
+            return recent_region_;
+        }
+        return find_region_(address);
+    }
+    [[nodiscard]] StorageRegion *find_region_(Word address) const noexcept;
+    /// Gets a block from region `pinned`, unless it is `ANY_REGION`, or else the first other
+    /// region that can supply one.
+    [[nodiscard]] Word get_block_preferring_(std::size_t pinned, unsigned order);
+    [[nodiscard]] Word get_block_from_(std::size_t region, unsigned order);
+};
+
+} // end namespace elsix
@@ -0,0 +1,452 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <cstring>
+#include <sys/mman.h>
+
+#include "storageregion.hpp"
+
+namespace elsix{
+
+// region: StorageRegion public interface
+
+StorageRegion::~StorageRegion(){
+    unmap_();
+}
+
+void StorageRegion::setup(Word first_word, unsigned max_order, Word last_word){
+    // The address 0 is the null pointer, so it cannot be the address of a block.
+    if(0 == first_word){
+        first_word = 1;
+    }
+    max_order_ = std::min(max_order, MAX_BLOCK_ORDER);
+    buddy_order_ = std::min(max_order_, small_block_limit_);
+    first_word_ = first_word;
+    // Round the size down to a whole number of maximal blocks so that every buddy lies within
+    // storage.
+    size_ = (last_word < first_word) ? 0 : last_word - first_word + 1;
+    size_ &= ~((Word{1} << buddy_order_) - 1);
+
+    // The large block window begins at the first page boundary after the buddy system's words.
+    Word page_words = LargeBlockAllocator::page_words();
+    large_offset_ = (size_ + page_words - 1) / page_words * page_words;
+    large_words_ = 0;
+    if(max_order_ > buddy_order_){
+        large_words_ = std::max(large_window_words_, Word{1} << max_order_);
+        large_words_ = (large_words_ + page_words - 1) / page_words * page_words;
+    }
+
+    // Reserve address space for everything, but make only the buddy system's words accessible.
+    unmap_();
+    mapped_words_ = large_offset_ + large_words_;
+    if(mapped_words_ > 0){
+        void *words = mmap(nullptr, mapped_words_ * sizeof(Word), PROT_NONE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        void *tags = mmap(nullptr, mapped_words_, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if(MAP_FAILED == words || MAP_FAILED == tags
+            || 0 != mprotect(words, size_ * sizeof(Word), PROT_READ | PROT_WRITE)){
+            // Without memory there is no storage at all.
+            if(MAP_FAILED != words){
+                munmap(words, mapped_words_ * sizeof(Word));
+            }
+            if(MAP_FAILED != tags){
+                munmap(tags, mapped_words_);
+            }
+            mapped_words_ = 0;
+            size_ = 0;
+            large_words_ = 0;
+        } else{
+            words_ = static_cast<Word *>(words);
+            tags_ = static_cast<std::uint8_t *>(tags);
+        }
+    }
+    large_blocks_.setup(0 == large_words_ ? nullptr : words_ + large_offset_, large_words_);
+
+    shared_sources_.clear();
+    shared_duplicates_.clear();
+    statistics_ = StorageStatistics();
+    for(unsigned order = 0; order <= MAX_BLOCK_ORDER; order++){
+        free_maps_[order].assign(order <= buddy_order_ ? ((size_ >> order) + 63) / 64 : 0, 0);
+        free_counts_[order] = 0;
+        available_counts_[order] = 0;
+        search_hints_[order] = 0;
+    }
+
+    // Initially storage is a sequence of maximal free blocks.
+    for(Word offset = 0; offset < size_; offset += Word{1} << buddy_order_){
+        push_free_(offset, buddy_order_);
+    }
+}
+
+Word StorageRegion::get_block(unsigned order){
+    Word offset;
+    if(!allocate_block_(order, offset)){
+        statistics_.failed_gets++;
+        return 0;
+    }
+    statistics_.blocks_gotten++;
+    tags_[offset] = static_cast<std::uint8_t>(order) | ALLOCATED;
+    if(order <= buddy_order_){
+        // Large blocks are freshly mapped and so already zero.
+        std::memset(words_ + offset, 0, sizeof(Word) << order);
+    }
+    return first_word_ + offset;
+}
+
+Word StorageRegion::get_chain(unsigned order, std::size_t count, const FieldDefinition &link,
+                               const FieldDefinition *back_link){
+    if(0 == count || order > max_order_){
+        statistics_.failed_gets++;
+        return 0;
+    }
+
+    // The chain is built from runs, each carved from a single buddy block of `run_order`. Only
+    // the last run may be shorter than `blocks_per_run` blocks. Large blocks are runs of one.
+    unsigned run_order = order;
+    while(run_order < buddy_order_ && (Word{1} << (run_order - order)) < count){
+        run_order++;
+    }
+    std::size_t blocks_per_run = std::size_t{1} << (run_order - order);
+    std::vector<Word> runs;
+    runs.reserve((count + blocks_per_run - 1) / blocks_per_run);
+
+    for(std::size_t remaining = count; remaining > 0;){
+        std::size_t run_blocks = std::min(remaining, blocks_per_run);
+        Word offset;
+        if(!allocate_block_(run_order, offset)){
+            // Out of storage. Give back what we took so that the operation is all or nothing. Every
+            // run taken so far is full, as only the last run can be short.
+            for(std::size_t run = 0; run < runs.size(); run++){
+                for(std::size_t i = 0; i < blocks_per_run; i++){
+                    free_offset_(runs[run] + (Word{i} << order), order);
+                }
+            }
+            statistics_.failed_gets++;
+            return 0;
+        }
+        Word run_words = Word{run_blocks} << order;
+        for(Word block = 0; block < run_words; block += Word{1} << order){
+            tags_[offset + block] = static_cast<std::uint8_t>(order) | ALLOCATED;
+        }
+        if(run_order <= buddy_order_){
+            std::memset(words_ + offset, 0, sizeof(Word) * run_words);
+            // The unused tail of the run goes back to free storage.
+            release_range_(offset + run_words, offset + (Word{1} << run_order));
+        }
+        runs.push_back(offset);
+        remaining -= run_blocks;
+    }
+
+    // Thread the links. Addresses are consecutive within each run.
+    Word previous = 0;
+    Word *previous_block = nullptr;
+    std::size_t linked = 0;
+    for(std::size_t run = 0; run < runs.size(); run++){
+        std::size_t run_blocks = std::min(count - linked, blocks_per_run);
+        for(std::size_t i = 0; i < run_blocks; i++){
+            Word address = first_word_ + runs[run] + (Word{i} << order);
+            Word *block = words_ + (address - first_word_);
+            if(nullptr != previous_block){
+                link.store(previous_block, address);
+            }
+            if(nullptr != back_link){
+                back_link->store(block, previous);
+            }
+            previous = address;
+            previous_block = block;
+        }
+        linked += run_blocks;
+    }
+
+    statistics_.blocks_gotten += count;
+    return first_word_ + runs.front();
+}
+
+Word StorageRegion::duplicate_block(Word source){
+    if(!contains(source)){
+        return 0;
+    }
+    Word source_offset = source - first_word_;
+    std::uint8_t tag = tags_[source_offset];
+    if(0 == (tag & ALLOCATED)){
+        return 0;
+    }
+    unsigned order = tag & ORDER_MASK;
+    Word offset;
+    if(!allocate_block_(order, offset)){
+        return 0;
+    }
+    tags_[offset] = static_cast<std::uint8_t>(order) | ALLOCATED;
+    statistics_.blocks_gotten++;
+    statistics_.duplicates++;
+
+    if(copy_on_write_){
+        // A duplicate of a duplicate shares the original's contents.
+        if(0 != (tag & SHARED_DUPLICATE)){
+            source_offset = shared_sources_[source_offset];
+        }
+        tags_[source_offset] |= SHARED_SOURCE;
+        tags_[offset] |= SHARED_DUPLICATE;
+        shared_sources_[offset] = source_offset;
+        shared_duplicates_[source_offset].push_back(offset);
+        statistics_.shared_duplicates++;
+    } else{
+        std::memcpy(words_ + offset, resolve(source), sizeof(Word) << order);
+        statistics_.words_copied += Word{1} << order;
+    }
+
+    return first_word_ + offset;
+}
+
+void StorageRegion::free_block(Word address){
+    if(!contains(address)){
+        return;
+    }
+    Word offset = address - first_word_;
+    std::uint8_t tag = tags_[offset];
+    if(0 == (tag & ALLOCATED)){
+        return;
+    }
+    if(0 != (tag & (SHARED_DUPLICATE | SHARED_SOURCE))){
+        // Freeing a shared block only copies if a duplicate outlives its source.
+        unshare_(offset, false);
+    }
+    free_offset_(offset, tag & ORDER_MASK);
+    statistics_.blocks_freed++;
+}
+
+// endregion: StorageRegion public interface
+
+// region: StorageRegion copy-on-write
+
+/**
+ * @brief Detaches the block at `offset` from the blocks it shares contents with.
+ *
+ * A duplicate is detached by copying its source's contents into it. A source is detached by
+ * copying its contents into its first duplicate, which becomes the source of the remaining
+ * duplicates. Either way at most one block is copied, and a duplicate that is about to be freed
+ * (`keep_contents` is false) is not copied at all.
+ */
+void StorageRegion::unshare_(Word offset, bool keep_contents){
+    Word source;
+    Word duplicate;
+    if(0 != (tags_[offset] & SHARED_DUPLICATE)){
+        source = shared_sources_[offset];
+        duplicate = offset;
+    } else{
+        source = offset;
+        duplicate = shared_duplicates_[source].front();
+    }
+    if(keep_contents || duplicate != offset){
+        unsigned order = tags_[source] & ORDER_MASK;
+        std::memcpy(words_ + duplicate, words_ + source, sizeof(Word) << order);
+        statistics_.deferred_copies++;
+        statistics_.words_copied += Word{1} << order;
+    }
+
+    std::vector<Word> &duplicates = shared_duplicates_[source];
+    duplicates.erase(std::find(duplicates.begin(), duplicates.end(), duplicate));
+    shared_sources_.erase(duplicate);
+    tags_[duplicate] &= ~SHARED_DUPLICATE;
+
+    if(duplicate != offset){
+        // The copy takes over the source's remaining duplicates.
+        for(Word other : duplicates){
+            shared_sources_[other] = duplicate;
+        }
+        if(!duplicates.empty()){
+            tags_[duplicate] |= SHARED_SOURCE;
+            shared_duplicates_[duplicate] = std::move(duplicates);
+        }
+        duplicates.clear();
+    }
+    if(duplicates.empty()){
+        shared_duplicates_.erase(source);
+        tags_[source] &= ~SHARED_SOURCE;
+    }
+}
+
+// endregion: StorageRegion copy-on-write
+
+// region: StorageRegion allocation
+
+/// Allocates a block of the given order from whichever allocator serves that order. Tags are left
+/// to the caller.
+bool StorageRegion::allocate_block_(unsigned order, Word &offset){
+    if(order <= buddy_order_){
+        return allocate_offset_(order, offset);
+    }
+    if(order > max_order_ || !large_blocks_.allocate(Word{1} << order, offset)){
+        return false;
+    }
+    offset += large_offset_;
+    return true;
+}
+
+/// Frees the block of the given order at `offset` to whichever allocator it came from.
+void StorageRegion::free_offset_(Word offset, unsigned order){
+    if(order <= buddy_order_){
+        release_(offset, order);
+        return;
+    }
+    tags_[offset] = 0;
+    large_blocks_.release(offset - large_offset_, Word{1} << order);
+}
+
+void StorageRegion::unmap_() noexcept{
+    if(0 != mapped_words_){
+        munmap(words_, mapped_words_ * sizeof(Word));
+        munmap(tags_, mapped_words_);
+    }
+    words_ = nullptr;
+    tags_ = nullptr;
+    mapped_words_ = 0;
+}
+
+// endregion: StorageRegion allocation
+
+// region: StorageRegion free maps
+
+bool StorageRegion::is_free_(Word offset, unsigned order) const noexcept{
+    Word index = offset >> order;
+    return 0 != (free_maps_[order][index / 64] & (std::uint64_t{1} << (index % 64)));
+}
+
+void StorageRegion::push_free_(Word offset, unsigned order) noexcept{
+    Word index = offset >> order;
+    free_maps_[order][index / 64] |= std::uint64_t{1} << (index % 64);
+    free_counts_[order]++;
+    for(unsigned smaller = 0; smaller <= order; smaller++){
+        available_counts_[smaller] += Word{1} << (order - smaller);
+    }
+    search_hints_[order] = std::min<std::size_t>(search_hints_[order], index / 64);
+    tags_[offset] = static_cast<std::uint8_t>(order);
+}
+
+void StorageRegion::remove_free_(Word offset, unsigned order) noexcept{
+    Word index = offset >> order;
+    free_maps_[order][index / 64] &= ~(std::uint64_t{1} << (index % 64));
+    free_counts_[order]--;
+    for(unsigned smaller = 0; smaller <= order; smaller++){
+        available_counts_[smaller] -= Word{1} << (order - smaller);
+    }
+}
+
+/// Removes and returns the lowest addressed free block of the given order, which must exist.
+Word StorageRegion::take_free_(unsigned order) noexcept{
+    std::vector<std::uint64_t> &map = free_maps_[order];
+    std::size_t i = search_hints_[order];
+    while(0 == map[i]){
+        i++;
+    }
+    search_hints_[order] = i;
+    Word offset = (Word{i} * 64 + __builtin_ctzll(map[i])) << order;
+    remove_free_(offset, order);
+    return offset;
+}
+
+/// Finds a free block of the given order, splitting a larger block if necessary. Tags are left to
+/// the caller.
+bool StorageRegion::allocate_offset_(unsigned order, Word &offset) noexcept{
+    unsigned available = order;
+    while(available <= buddy_order_ && 0 == free_counts_[available]){
+        available++;
+    }
+    if(available > buddy_order_){
+        return false;
+    }
+    offset = take_free_(available);
+    // Return the upper halves to free storage until we are down to the requested size.
+    while(available > order){
+        available--;
+        push_free_(offset + (Word{1} << available), available);
+    }
+    return true;
+}
+
+/// Returns `[begin, end)`, which lies within a single block, to free storage as a sequence of
+/// maximal aligned blocks. None of them can coalesce with its buddy, which is either in use or
+/// itself a part of the sequence.
+void StorageRegion::release_range_(Word begin, Word end) noexcept{
+    while(begin < end){
+        unsigned order = 0;
+        while(order < buddy_order_
+            && 0 == (begin & (Word{1} << order))
+            && begin + (Word{2} << order) <= end){
+            order++;
+        }
+        push_free_(begin, order);
+        begin += Word{1} << order;
+    }
+}
+
+/// Frees the block at `offset`, coalescing it with its buddy as long as the buddy is free.
+void StorageRegion::release_(Word offset, unsigned order) noexcept{
+    // Clear the tag so that a stale pointer to a coalesced block is not mistaken for a block.
+    tags_[offset] = 0;
+    while(order < buddy_order_){
+        Word buddy = offset ^ (Word{1} << order);
+        if(!is_free_(buddy, order)){
+            break;
+        }
+        remove_free_(buddy, order);
+        offset &= ~(Word{1} << order);
+        order++;
+    }
+    push_free_(offset, order);
+}
+
+bool StorageRegion::verify_available_counts() const{
+    std::array<Word, MAX_BLOCK_ORDER + 1> counts{};
+    for(unsigned order = 0; order <= buddy_order_; order++){
+        Word free_blocks = 0;
+        for(std::uint64_t bits : free_maps_[order]){
+            free_blocks += __builtin_popcountll(bits);
+        }
+        if(free_blocks != free_counts_[order]){
+            return false;
+        }
+        for(unsigned smaller = 0; smaller <= order; smaller++){
+            counts[smaller] += free_blocks << (order - smaller);
+        }
+    }
+    for(unsigned order = 0; order <= buddy_order_; order++){
+        if(counts[order] != available_counts_[order]){
+            return false;
+        }
+    }
+    return large_blocks_.verify_available_counts();
+}
+
+// endregion: StorageRegion free maps
+
+} // end namespace elsix
@@ -0,0 +1,340 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief A region of storage, as established by one Setup Storage, with its own allocators.
+ *
+ * A region is a range of words `[first_word, last_word]` given by `(s1, SS, d, s2)`. Addresses are
+ * word addresses within this range rather than host pointers, so that a pointer fits in a field
+ * of the width the historical programs use (e.g. `(1, DD, 0, 23)`). The address 0 is the null
+ * pointer and is never handed out.
+ *
+ * Blocks are 2^n words for 0 <= n <= d. Blocks of up to 2^7 words, the historical maximum, are
+ * managed with a binary buddy system within `[first_word, last_word]`. Larger blocks, up to 2^20
+ * words, are served by a `LargeBlockAllocator` from a window of addresses just above
+ * `last_word`. Both live in one host mapping, so an address translates to a host address by the
+ * same subtraction whichever allocator it came from. Free blocks of
+ * each order are recorded in a bitmap rather than in a list threaded through the blocks, because
+ * a one word block has no room for the two links that O(1) removal of a buddy would require.
+ * Scanning a bitmap also hands out blocks in address order, which keeps lists built by successive
+ * `GT`s laid out sequentially.
+ *
+ * Duplicate Block can optionally be copy-on-write. The duplicate is allocated but not filled in;
+ * it reads through to the block it duplicates until either of them is written or freed. Reads
+ * must therefore go through `resolve()` and writes through `resolve_for_write()`.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+#include "field.hpp"
+#include "largeblocks.hpp"
+
+namespace elsix{
+
+/// By default, following the historical implementations, the buddy system serves blocks of up to
+/// 2^7 words, and larger blocks are large blocks.
+constexpr unsigned DEFAULT_SMALL_BLOCK_ORDER = 7;
+/// By default the window for large blocks spans 2^24 words of address space.
+constexpr Word DEFAULT_LARGE_BLOCK_WINDOW = Word{1} << 24;
+
+/**
+ * @brief Counters kept by each storage region.
+ */
+struct StorageStatistics{
+    // Blocks handed out by Get Block and Get Chain.
+    std::size_t blocks_gotten = 0;
+    // Blocks returned by Free Block.
+    std::size_t blocks_freed = 0;
+    // Get Block and Get Chain operations the region could not satisfy.
+    std::size_t failed_gets = 0;
+    // Duplicate Block operations.
+    std::size_t duplicates = 0;
+    // Duplicates made copy-on-write.
+    std::size_t shared_duplicates = 0;
+    // Copies forced by a write to or the freeing of a shared block.
+    std::size_t deferred_copies = 0;
+    // Words actually copied by Duplicate Block, eagerly or deferred.
+    std::size_t words_copied = 0;
+};
+
+class StorageRegion{
+public:
+    StorageRegion() = default;
+    ~StorageRegion();
+    StorageRegion(const StorageRegion &) = delete;
+    StorageRegion &operator=(const StorageRegion &) = delete;
+
+    /**
+     * @brief Implements `(s1, SS, d, s2)`. Any previous storage is discarded.
+     * @param first_word: The address of the first word of storage.
+     * @param max_order: The largest block that will be requested is 2^max_order words. If this
+     * exceeds the small block limit, a window for large blocks is reserved above `last_word`.
+     * @param last_word: The address of the last word of storage.
+     */
+    void setup(Word first_word, unsigned max_order, Word last_word);
+
+    /**
+     * @brief Implements `(a, GT, cd)`.
+     * @param order: The block will be 2^order words long.
+     * @return The address of a zeroed block, or 0 if storage is exhausted.
+     */
+    [[nodiscard]] Word get_block(unsigned order);
+
+    /**
+     * @brief Implements `(a, GL, cd, n, f)`: gets `count` blocks of 2^order words in one
+     * operation and links each to the next through `link`. The last block's `link` is 0. If
+     * `back_link` is given, each block's `back_link` points to the previous block, the first
+     * block's to 0.
+     *
+     * When the whole chain fits in a single block of at most 2^max_order words, it is carved
+     * from one buddy split, so the blocks are contiguous and in list order. Longer chains are
+     * made of such runs. Either way each block can be freed individually with `FR`.
+     *
+     * @return The address of the head of the chain, or 0 if storage is exhausted, in which case
+     * nothing is allocated.
+     */
+    [[nodiscard]] Word get_chain(unsigned order, std::size_t count, const FieldDefinition &link,
+                                 const FieldDefinition *back_link = nullptr);
+
+    /**
+     * @brief Implements `(a, DP, c)`.
+     * @param source: The address of the block to duplicate.
+     * @return The address of a block of the same size with the same contents, or 0 if storage is
+     * exhausted or `source` is not a block.
+     */
+    [[nodiscard]] Word duplicate_block(Word source);
+
+    /// Implements `(a, FR, 0)`. Freeing 0 or an address that is not an allocated block is a no-op.
+    void free_block(Word address);
+
+    /// Sets the largest order served by the buddy system at the next `setup()`. Larger blocks are
+    /// large blocks.
+    void set_small_block_limit(unsigned order) noexcept{
+        small_block_limit_ = std::min(order, MAX_BLOCK_ORDER);
+    }
+
+    /// Sets the number of words of address space reserved for large blocks at the next `setup()`.
+    void set_large_block_window(Word words) noexcept{
+        large_window_words_ = words;
+    }
+
+    /**
+     * @brief Implements `n.`: the number of blocks of 2^order words that could be gotten one
+     * after another, counting free blocks of that order and those that splitting larger free
+     * blocks would yield. The counts are kept up to date as blocks are gotten and freed, so this
+     * is a lookup.
+     */
+    [[nodiscard]] Word available_blocks(unsigned order) const noexcept{
+        if(order > max_order_){
+            return 0;
+        }
+        return (order <= buddy_order_) ? available_counts_[order]
+                                       : large_blocks_.available_blocks(order);
+    }
+
+    /**
+     * @brief Recomputes the counts behind `available_blocks()` by scanning the free maps and the
+     * free large block ranges. For debugging.
+     * @return False if any count disagrees with the scan.
+     */
+    [[nodiscard]] bool verify_available_counts() const;
+
+    /// The number of host pages currently holding large blocks.
+    [[nodiscard]] std::size_t large_pages_mapped() const noexcept{
+        return large_blocks_.mapped_pages();
+    }
+
+    /// Makes subsequent Duplicate Block operations copy-on-write. Off by default.
+    void set_copy_on_write(bool enabled) noexcept{
+        copy_on_write_ = enabled;
+    }
+
+    [[nodiscard]] const StorageStatistics &statistics() const noexcept{
+        return statistics_;
+    }
+
+    /// Is `address` within storage?
+    [[nodiscard]] bool contains(Word address) const noexcept{
+        Word offset = address - first_word_;
+        return offset < size_ || offset - large_offset_ < large_words_;
+    }
+
+    /// Translates the address of a block to the host address of its contents for reading, or
+    /// `nullptr` for an address in the large block window that is not that of an allocated large
+    /// block, since the pages there may be inaccessible.
+    [[nodiscard]] const Word *resolve(Word address) const noexcept{
+        Word offset = address - first_word_;
+        if(offset >= size_ && 0 == (tags_[offset] & ALLOCATED)){
+            return nullptr;
+        }
+        if(0 != (tags_[offset] & SHARED_DUPLICATE)){
+            offset = shared_sources_.find(offset)->second;
+        }
+        return words_ + offset;
+    }
+
+    /// Translates the address of a block to the host address of its contents for writing. If the
+    /// block shares its contents with another, it gets its own copy first. As `resolve()`, it is
+    /// `nullptr` for an address in the large block window that is not that of a large block.
+    [[nodiscard]] Word *resolve_for_write(Word address){
+        Word offset = address - first_word_;
+        if(offset >= size_ && 0 == (tags_[offset] & ALLOCATED)){
+            return nullptr;
+        }
+        if(0 != (tags_[offset] & (SHARED_DUPLICATE | SHARED_SOURCE))){
+            unshare_(offset);
+        }
+        return words_ + offset;
+    }
+
+    /// Is `address` the address of an allocated block?
+    [[nodiscard]] bool is_block(Word address) const noexcept{
+        return contains(address) && 0 != (tags_[address - first_word_] & ALLOCATED);
+    }
+
+    /// The number of words a field access at `address`, which `resolve()` translates, may reach:
+    /// the size of the allocated block there, or else the words up to the end of the buddy system.
+    [[nodiscard]] Word block_words(Word address) const noexcept{
+        Word offset = address - first_word_;
+        if(0 != (tags_[offset] & ALLOCATED)){
+            return Word{1} << (tags_[offset] & ORDER_MASK);
+        }
+        return (offset < size_) ? size_ - offset : 0;
+    }
+
+    /// The order of the allocated block beginning at `address`.
+    [[nodiscard]] unsigned order_of(Word address) const noexcept{
+        return tags_[address - first_word_] & ORDER_MASK;
+    }
+
+    [[nodiscard]] unsigned max_order() const noexcept{
+        return max_order_;
+    }
+
+    /**
+     * @brief What compiled code needs to translate addresses in the buddy system part of the
+     * region without calling in. Address `a` is word `a - first_word` of `words` if that is below
+     * `size` and its tag has no bit of `read_barrier` set, or of `write_barrier` when writing.
+     * The tag of an allocated block, masked by `allocated | order_mask`, is `allocated` plus its
+     * order. Any other address must go through `resolve()` or `resolve_for_write()`.
+     */
+    struct DirectAccess{
+        Word *words;
+        const std::uint8_t *tags;
+        Word first_word;
+        Word size;
+        std::uint8_t read_barrier;
+        std::uint8_t write_barrier;
+        std::uint8_t allocated;
+        std::uint8_t order_mask;
+    };
+
+    [[nodiscard]] DirectAccess direct_access() const noexcept{
+        return {words_, tags_, first_word_, size_, SHARED_DUPLICATE,
+                static_cast<std::uint8_t>(SHARED_DUPLICATE | SHARED_SOURCE), ALLOCATED,
+                ORDER_MASK};
+    }
+
+    /// The address of the first word of the region.
+    [[nodiscard]] Word first_word() const noexcept{
+        return first_word_;
+    }
+
+    /// One past the last address of the region, including its large block window. Without a
+    /// window the region ends with its last word, not at the page boundary a window would follow.
+    [[nodiscard]] Word end_word() const noexcept{
+        return first_word_ + ((0 == large_words_) ? size_ : large_offset_ + large_words_);
+    }
+
+private:
+    // Tag bits describing the block beginning at a given word. Only meaningful at block starts.
+    static constexpr std::uint8_t ORDER_MASK = 0x1f;
+    // A copy-on-write duplicate whose contents are those of its source.
+    static constexpr std::uint8_t SHARED_DUPLICATE = 0x20;
+    // A block with copy-on-write duplicates.
+    static constexpr std::uint8_t SHARED_SOURCE = 0x40;
+    static constexpr std::uint8_t ALLOCATED = 0x80;
+
+    Word first_word_ = 0;
+    // The number of words managed by the buddy system, a multiple of 2^buddy_order_.
+    Word size_ = 0;
+    unsigned max_order_ = 0;
+    // The largest order served by the buddy system.
+    unsigned buddy_order_ = 0;
+    unsigned small_block_limit_ = DEFAULT_SMALL_BLOCK_ORDER;
+    Word large_window_words_ = DEFAULT_LARGE_BLOCK_WINDOW;
+    // The large block window is `[large_offset_, large_offset_ + large_words_)`, page aligned.
+    Word large_offset_ = 0;
+    Word large_words_ = 0;
+    LargeBlockAllocator large_blocks_;
+    // The host mapping of all storage, `large_offset_ + large_words_` words, of which the first
+    // `size_` are accessible and the rest belong to `large_blocks_`.
+    Word *words_ = nullptr;
+    Word mapped_words_ = 0;
+    // One tag per word, mapped lazily so that the large block window costs only the pages of
+    // tags actually written.
+    std::uint8_t *tags_ = nullptr;
+    // Bit `i` of `free_maps_[n]` is set iff the block of order `n` at offset `i << n` is free.
+    std::array<std::vector<std::uint64_t>, MAX_BLOCK_ORDER + 1> free_maps_;
+    std::array<std::size_t, MAX_BLOCK_ORDER + 1> free_counts_{};
+    // `available_counts_[n]` is the sum over orders `m >= n` of `free_counts_[m] << (m - n)`.
+    std::array<Word, MAX_BLOCK_ORDER + 1> available_counts_{};
+    // No word of `free_maps_[n]` below `search_hints_[n]` has a bit set.
+    std::array<std::size_t, MAX_BLOCK_ORDER + 1> search_hints_{};
+
+    bool copy_on_write_ = false;
+    // Maps the offset of each copy-on-write duplicate to the offset of its source.
+    std::unordered_map<Word, Word> shared_sources_;
+    // Maps the offset of each source to the offsets of its duplicates. The length of the vector
+    // is the reference count of the source.
+    std::unordered_map<Word, std::vector<Word>> shared_duplicates_;
+    StorageStatistics statistics_;
+
+    [[nodiscard]] bool is_free_(Word offset, unsigned order) const noexcept;
+    void push_free_(Word offset, unsigned order) noexcept;
+    void remove_free_(Word offset, unsigned order) noexcept;
+    [[nodiscard]] Word take_free_(unsigned order) noexcept;
+    [[nodiscard]] bool allocate_offset_(unsigned order, Word &offset) noexcept;
+    [[nodiscard]] bool allocate_block_(unsigned order, Word &offset);
+    void free_offset_(Word offset, unsigned order);
+    void unmap_() noexcept;
+    void release_range_(Word begin, Word end) noexcept;
+    void release_(Word offset, unsigned order) noexcept;
+    void unshare_(Word offset, bool keep_contents = true);
+};
+
+} // end namespace elsix
@@ -48,14 +48,14 @@ void split(const std::string &s, char delim, Out result){
     }
 }
 
-inline std::vector<std::string> split(const std::string &s, char delimiter) noexcept{
+std::vector<std::string> split(const std::string &s, char delimiter) noexcept{
     std::vector<std::string> elems;
     split(s, delimiter, std::back_inserter(elems));
     return elems;
 }
 
 // trim from start (in place)
-inline void ltrim(std::string &s) noexcept{
+void ltrim(std::string &s) noexcept{
     s.erase(
         s.begin(), std::find_if(
             s.begin(), s.end(), [](int ch){
@@ -65,7 +65,7 @@ inline void ltrim(std::string &s) noexcept{
 }
 
 // trim from end (in place)
-inline void rtrim(std::string &s) noexcept{
+void rtrim(std::string &s) noexcept{
     s.erase(
         std::find_if(
             s.rbegin(), s.rend(), [](int ch){
@@ -75,25 +75,25 @@ inline void rtrim(std::string &s) noexcept{
 }
 
 // trim from both ends (in place)
-inline void trim(std::string &s) noexcept{
+void trim(std::string &s) noexcept{
     ltrim(s);
     rtrim(s);
 }
 
 // trim from start (copying)
-[[nodiscard]] inline std::string ltrim_copy(std::string s) noexcept{
+[[nodiscard]] std::string ltrim_copy(std::string s) noexcept{
     ltrim(s);
     return s;
 }
 
 // trim from end (copying)
-[[nodiscard]] inline std::string rtrim_copy(std::string s) noexcept{
+[[nodiscard]] std::string rtrim_copy(std::string s) noexcept{
     rtrim(s);
     return s;
 }
 
 // trim from both ends (copying)
-[[nodiscard]] inline std::string trim_copy(std::string s) noexcept{
+[[nodiscard]] std::string trim_copy(std::string s) noexcept{
     trim(s);
     return s;
 }
@@ -101,11 +101,11 @@ inline void trim(std::string &s) noexcept{
 
 // region: Character classes.
 
-[[nodiscard]] bool inline isBug(char c) noexcept{
+[[nodiscard]] bool isBug(char c) noexcept{
     return isalpha(c);
 }
 
-[[nodiscard]] bool inline isAlphanumeric(char c) noexcept{
+[[nodiscard]] bool isAlphanumeric(char c) noexcept{
     return isalnum(c);
 }
 
@@ -117,52 +117,52 @@ inline void trim(std::string &s) noexcept{
  * @param c : A character to check.
  * @return True for False.
  */
-[[nodiscard]] bool inline isHollerith(char c) noexcept{
+[[nodiscard]] bool isHollerith(char c) noexcept{
     return isalnum(c) || c == '.';
 }
 
-[[nodiscard]] bool inline isDigit(char c) noexcept{
+[[nodiscard]] bool isDigit(char c) noexcept{
     return isdigit(c);
 }
 
-[[nodiscard]] bool inline isOctal(char c) noexcept{
+[[nodiscard]] bool isOctal(char c) noexcept{
     return isdigit(c) && '8' > c;
 }
 
-[[nodiscard]] bool inline isHex(char c) noexcept{
+[[nodiscard]] bool isHex(char c) noexcept{
     return isxdigit(c);
 }
 
-[[nodiscard]] bool inline isBlank(char c) noexcept{
+[[nodiscard]] bool isBlank(char c) noexcept{
     return isblank(c);
 }
 
-[[nodiscard]] bool inline isNewline(char c) noexcept{
+[[nodiscard]] bool isNewline(char c) noexcept{
     return isspace(c) && !isblank(c);
 }
 // endregion
 
 // region: word classes
 
-[[nodiscard]] bool inline isNumber(const std::string &name){
+[[nodiscard]] bool isNumber(const std::string &name){
     return std::all_of(
         name.begin(), name.end(), [](char c){ return std::isdigit(c); }
     );
 }
 
-[[nodiscard]] bool inline isAlphabetic(const std::string &name){
+[[nodiscard]] bool isAlphabetic(const std::string &name){
     return std::all_of(
         name.begin(), name.end(), [](char c){ return std::isalpha(c); }
     );
 }
 
-[[nodiscard]] bool inline isHollerith(const std::string &name){
+[[nodiscard]] bool isHollerith(const std::string &name){
     return std::all_of(
         name.begin(), name.end(), [](char c){ return isHollerith(c); }
     );
 }
 
-[[nodiscard]] bool inline isOctal(const std::string &name){
+[[nodiscard]] bool isOctal(const std::string &name){
     return std::all_of(
         name.begin(), name.end(), [](char c){ return (0 <= c) && (8 >= c); }
     );
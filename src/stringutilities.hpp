@@ -33,6 +33,10 @@
 #include <algorithm>
 #include <cctype>
 #include <locale>
+#include <string>
+#include <vector>
+
+namespace elsix{
 
 /**
  * @brief Split the given string on the delimiter.
@@ -46,19 +50,19 @@
  * @brief Trim from start (in place)
  * @param s
  */
-inline void ltrim(std::string &s) noexcept;
+void ltrim(std::string &s) noexcept;
 
 /**
  * @brief trim from end (in place)
  * @param s
  */
-inline void rtrim(std::string &s) noexcept;
+void rtrim(std::string &s) noexcept;
 
 /**
  * @brief trim from both ends (in place)
  * @param s
  */
-inline void trim(std::string &s) noexcept;
+void trim(std::string &s) noexcept;
 
 /**
  * @brief trim from start (copying)
@@ -143,3 +147,5 @@ inline void trim(std::string &s) noexcept;
 [[nodiscard]] bool isHollerith(const std::string &name);
 
 // endregion: word classes.
+
+} // end namespace elsix
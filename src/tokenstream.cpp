@@ -28,6 +28,8 @@
 
     */
 
+#include <cassert>
+
 #include "stringutilities.hpp"
 #include "tokenstream.hpp"
 #include "sourcefile.hpp"
@@ -35,14 +37,13 @@
 #include "error.hpp"
 #include "astnode.hpp"
 #include "location.hpp"
-
 namespace elsix{
 
 TokenStream::TokenStream(const std::string &source_filename) : source_file_(
     SourceFile(
         source_filename
     )), error_handler_(ErrorHandler()){
-    cursor_ = Location(0, -1);
+    cursor_ = Location(0, 0);
 }
 
 ASTNode_sp TokenStream::next(){
@@ -51,37 +52,31 @@ ASTNode_sp TokenStream::next(){
         tokenize_next_();
     }
     ASTNode_sp token = std::make_shared<ASTNode>(std::move(*staged_token_));
-    // The staged_token_ is freed by the shared_ptr.
+    delete staged_token_;
     staged_token_ = nullptr;
     return token;
 }
 
 /**
  * @brief Returns the next character in the stream and consumes it.
+ *
+ * The cursor is always at the next character to be read. Every line, including the last, ends in
+ * an `EOL_CHARACTER`, after which the cursor is at the start of the following line.
+ *
  * @return The next character in the character stream.
  */
 char TokenStream::next_char_(){
-    // If we are already at EOF, return `EOF_CHARACTER`.
-    if(cursor_ == source_file_.eof()){
-        return EOF_CHARACTER;
+    char c = peek_char_();
+    if(EOF_CHARACTER == c){
+        return c;
     }
-    
-    // Otherwise, move cursor_ to the next position.
-    if(cursor_.column == static_cast<int>(source_file_.lines[cursor_.row].length() - 1)){
-        // We're at EOL. The next position is on the next line.
+    if(EOL_CHARACTER == c){
         cursor_.row++;
         cursor_.column = 0;
-        return EOL_CHARACTER;
     } else{
         cursor_.column++;
     }
-    
-    // If we're at EOF, return `EOF_CHARACTER`.
-    if(cursor_ == source_file_.eof()){
-        return EOF_CHARACTER;
-    }
-    
-    return source_file_.lines[cursor_.row][cursor_.column];
+    return c;
 }
 
 /**
@@ -89,32 +84,14 @@ char TokenStream::next_char_(){
  * @return The next character in the character stream.
  */
 char TokenStream::peek_char_(){
-    // This code is identical to `next_char_()` except that it uses a copy of `cursor_`
-    // instead of `cursor_` itself. A bit non-DRY.
-    
-    // If we are already at EOF, return `EOF_CHARACTER`.
-    if(cursor_ == source_file_.eof()){
+    if(cursor_.row >= source_file_.lines.size()){
         return EOF_CHARACTER;
     }
-    
-    Location next_location = cursor_;
-    
-    // Otherwise, move cursor_ to the next position.
-    if(next_location.column == static_cast<int>(source_file_.lines[cursor_.row].length() - 1)){
-        // We're at EOL. The next position is on the next line.
-        next_location.row++;
-        next_location.column = 0;
+    std::string_view line = source_file_.lines[cursor_.row];
+    if(static_cast<std::size_t>(cursor_.column) >= line.size()){
         return EOL_CHARACTER;
-    } else{
-        next_location.column++;
-    }
-    
-    // If we're at EOF, return `EOF_CHARACTER`.
-    if(next_location == source_file_.eof()){
-        return EOF_CHARACTER;
     }
-    
-    return source_file_.lines[next_location.row][next_location.column];
+    return line[cursor_.column];
 }
 
 void TokenStream::tokenize_next_(){
@@ -124,11 +101,14 @@ void TokenStream::tokenize_next_(){
     // Warning: Nothing enforces this contract but this assert!
     assert(nullptr == staged_token_);
     
-    staged_token_ = new ASTNode(NodeType::UNDEFINED, Span(cursor_));
-    char c = next_nonblank_char_();
+    skip_blanks_();
+    staged_token_ = new ASTNode(NodeType::UNDEFINED, Span(cursor_, cursor_));
+    char c = next_char_();
+    const char first = c;
     
-    // Since we are scanning the token anyway, we might as well estimate its type.
-    bool is_number = isDigit(c);             // Does not detect hex.
+    // Since we are scanning the token anyway, we might as well estimate its type. A number
+    // written with a leading `*`, as in `*20000400`, is octal.
+    bool is_number = isDigit(c) || (STAR_TOKEN == c && isDigit(peek_char_()));
     bool is_hollerith = isHollerith(c);      // Hollerith literals are alphanumeric or '.'.
     bool is_newline = (EOL_CHARACTER == c);  // Newlines are normalized to EOL_CHARACTER by
     // next_char_().
@@ -136,23 +116,39 @@ void TokenStream::tokenize_next_(){
     // The first `c` character is special, because it is `nextNonBlank_`,
     // i.e. it does not have to be contiguous with the previously read character.
     if(is_number || is_hollerith){
+        bool single = true;
         while(isAlphanumeric(c = peek_char_())){
+            single = false;
             // ToDo: If it starts with a number, it must be a number. Otherwise, emit an error.
             is_number = is_number && isDigit(c);
             is_hollerith = is_hollerith && isHollerith(c);
             next_char_();
         }
+        // `T.`, the clock, and `n.`, the number of blocks of 2^n words available, are the only
+        // tokens that end in a period.
+        if('.' == peek_char_()){
+            if(single && ('T' == first || 't' == first)){
+                next_char_();
+                is_hollerith = false;
+                staged_token_->type = NodeType::T_DOT;
+            } else if(is_number && STAR_TOKEN != first){
+                next_char_();
+                is_number = false;
+                staged_token_->type = NodeType::N_DOT;
+            }
+        }
     } else if(is_newline){
-        // We don't bother reporting multiple consecutive newlines. However, adjacent newlines
-        // are included in the span.
-        while(EOL_CHARACTER == (c = peek_char_())){
+        // We don't bother reporting multiple consecutive newlines, or the blank and comment lines
+        // between them. However, they are included in the span.
+        skip_blanks_();
+        while(EOL_CHARACTER == peek_char_()){
             next_char_();
+            skip_blanks_();
         }
     }
     
-    // Adjust `end` to be one past the last char.
+    // `end` is one past the last char.
     staged_token_->span.end = cursor_;
-    staged_token_->span.end.column++;
     
     // We do some initial rudimentary NodeType guessing. The parser knows more about how to
     // determine NodeType, because it has more context, so this is just a hint to the parser. For
@@ -169,13 +165,12 @@ void TokenStream::tokenize_next_(){
     } else if(is_newline){
         staged_token_->type = NodeType::EOL;
         return;
-    }
-    // The remaining checks only apply to single character tokens.
-    if(source_file_.span_length(staged_token_->span) != 1){
+    } else if(NodeType::T_DOT == staged_token_->type || NodeType::N_DOT == staged_token_->type){
+        staged_token_->value = span_to_string(staged_token_->span);
         return;
     }
-    switch(*source_file_.loc_to_ptr(staged_token_->span.start)){
-        // ToDo: Figure out how `T.` and `n.` were intended to work, and implement them here.
+    // The remaining checks only apply to single character tokens.
+    switch(first){
         case EOF_CHARACTER:staged_token_->type = NodeType::EOF_;
             break;
         case COMMA_TOKEN:staged_token_->type = NodeType::COMMA;
@@ -190,26 +185,20 @@ void TokenStream::tokenize_next_(){
 }
 
 /**
- * @brief Consumes all blanks and the first single nonblank character
- *        of the input, returning its value.
- *
- * @return The char value.
+ * @brief Consumes all blanks and, if a comment follows them, the comment, up to but not
+ * including the end of the line.
  */
-char TokenStream::next_nonblank_char_(){
-    char c = next_char_();
-    
-    while(isBlank(c)){
-        c = next_char_();
+void TokenStream::skip_blanks_(){
+    while(isBlank(peek_char_())){
+        next_char_();
     }
     
     // Eat comments
-    if(COMMENT_TOKEN == c){
-        do{
-            c = next_char_();
-        } while(c != EOF_CHARACTER && c != EOL_CHARACTER);
+    if(COMMENT_TOKEN == peek_char_()){
+        while(EOF_CHARACTER != peek_char_() && EOL_CHARACTER != peek_char_()){
+            next_char_();
+        }
     }
-    
-    return c;
 }
 
 /**
@@ -236,4 +225,3 @@ std::string_view TokenStream::span_to_string(Span span) const{
 }
 
 }
-
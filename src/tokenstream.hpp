@@ -73,7 +73,7 @@ private:
     Location cursor_;
     ASTNode *staged_token_ = nullptr;
     
-    char next_nonblank_char_();
+    void skip_blanks_();
     char next_char_();
     char peek_char_();
     void tokenize_next_();
@@ -0,0 +1,524 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include <spawn.h>
+#include <sys/wait.h>
+
+#include "fmt/format.h"
+
+#include "transpiler.hpp"
+
+extern char **environ;
+
+namespace elsix{
+
+namespace{
+
+std::string literal(Word value){
+    return fmt::format("{}ULL", value);
+}
+
+/// Replaces each `$` in `pattern` with `current`.
+std::string substitute(const std::string &pattern, const std::string &current){
+    std::string result;
+    for(char c : pattern){
+        if('$' == c){
+            result += current;
+        } else{
+            result += c;
+        }
+    }
+    return result;
+}
+
+const char *comparison(Opcode opcode) noexcept{
+    switch(opcode){
+        case Opcode::TEST_EQUAL:[[fallthrough]];
+        case Opcode::TEST_SAME_BLOCK:return "==";
+        case Opcode::TEST_NOT_EQUAL:return "!=";
+        case Opcode::TEST_GREATER:return ">";
+        case Opcode::TEST_LESS:return "<";
+        default:return nullptr;
+    }
+}
+
+/// The operations of the form `a = f(a, b)`, written with `$` for `a` and `#` for `b`.
+const char *binary_operation(Opcode opcode) noexcept{
+    switch(opcode){
+        case Opcode::SET_EQUAL:[[fallthrough]];
+        case Opcode::POINT:return "#";
+        case Opcode::ADD:return "$ + #";
+        case Opcode::SUBTRACT:return "$ - #";
+        case Opcode::MULTIPLY:return "$ * #";
+        case Opcode::DIVIDE:return "Runtime::divide($, #)";
+        case Opcode::OR:return "$ | #";
+        case Opcode::AND:return "$ & #";
+        case Opcode::EXCLUSIVE_OR:return "$ ^ #";
+        case Opcode::COMPLEMENT:return "~#";
+        case Opcode::LEFT_ONE:return "left_one(#)";
+        case Opcode::LEFT_ZERO:return "left_zero(#)";
+        case Opcode::RIGHT_ONE:return "right_one(#)";
+        case Opcode::RIGHT_ZERO:return "right_zero(#)";
+        case Opcode::COUNT_ONES:return "count_ones(#)";
+        case Opcode::COUNT_ZEROES:return "count_zeroes(#)";
+        case Opcode::INPUT:return "rt.input(#)";
+        case Opcode::BINARY_TO_DECIMAL:return "binary_to_decimal(#)";
+        case Opcode::DECIMAL_TO_BINARY:return "decimal_to_binary(#)";
+        case Opcode::BINARY_TO_OCTAL:return "binary_to_octal(#)";
+        case Opcode::OCTAL_TO_BINARY:return "octal_to_binary(#)";
+        case Opcode::BLANKS_TO_ZEROES:return "blanks_to_zeroes(#)";
+        case Opcode::ZEROES_TO_BLANKS:return "zeroes_to_blanks(#)";
+        default:return nullptr;
+    }
+}
+
+} // end anonymous namespace
+
+Transpiler::Transpiler(const Program &program) : program_(program){
+}
+
+std::string Transpiler::translate(){
+    out_.clear();
+    find_targets_();
+    constants_ = std::make_unique<FieldConstants>(program_);
+
+    out_ += "// Translated from L6 by Elsix.\n\n"
+            "#include \"runtime.hpp\"\n"
+            "#include \"conversion.hpp\"\n\n"
+            "using namespace elsix;\n\n"
+            "namespace{\n\n"
+            "int l6_program(Runtime &rt){\n"
+            "    Word *const bug = rt.bugs.data();\n"
+            "    std::uint32_t site;\n";
+
+    std::uint32_t line = NO_INDEX;
+    for(std::uint32_t index = 0; index < program_.instructions.size(); index++){
+        const Instruction &instruction = program_.instructions[index];
+        if(instruction.line != line){
+            line = instruction.line;
+            const LineInfo &info = program_.lines[line];
+            out_ += fmt::format("\n    // Line {}{}{}\n", info.row + 1,
+                                program_.label(info).empty() ? "" : ": ",
+                                program_.label(info));
+        }
+        if(targets_[index]){
+            out_ += fmt::format("I{}:;\n", index);
+        }
+        emit_instruction_(index);
+    }
+
+    out_ += "\ndone_return:\n";
+    emit_return_dispatch_(true);
+    out_ += "fail_return:\n";
+    emit_return_dispatch_(false);
+    out_ += "}\n\n"
+            "} // end anonymous namespace\n\n"
+            "int main(int argc, char **argv){\n"
+            "    return run_compiled(argc, argv, l6_program);\n"
+            "}\n";
+    return std::move(out_);
+}
+
+void Transpiler::find_targets_(){
+    targets_.assign(program_.instructions.size(), false);
+    call_sites_.clear();
+    for(std::uint32_t index = 0; index < program_.instructions.size(); index++){
+        const Instruction &instruction = program_.instructions[index];
+        if(NO_INDEX != instruction.target){
+            targets_[instruction.target] = true;
+        }
+        if(NO_INDEX != instruction.alternate){
+            targets_[instruction.alternate] = true;
+        }
+        if(Opcode::SWITCH == instruction.opcode){
+            for(std::uint32_t i = 0; i < instruction.operands[2]; i++){
+                std::uint32_t target = program_.cases[instruction.operands[3] + i].target;
+                if(target != index + 1){
+                    targets_[target] = true;
+                }
+            }
+        }
+        if(Opcode::CALL == instruction.opcode){
+            call_sites_.push_back(index);
+        }
+    }
+}
+
+void Transpiler::emit_return_dispatch_(bool done){
+    out_ += fmt::format("    if(rt.calls.empty()){{\n"
+                        "        return {};\n"
+                        "    }}\n"
+                        "    site = rt.calls.back();\n"
+                        "    rt.calls.pop_back();\n"
+                        "    switch(site){{\n", done ? "EXIT_DONE" : "EXIT_FAIL");
+    for(std::uint32_t site = 0; site < call_sites_.size(); site++){
+        std::uint32_t alternate = program_.instructions[call_sites_[site]].alternate;
+        if(done || NO_INDEX == alternate){
+            out_ += fmt::format("        case {}:goto R{};\n", site, site);
+        } else{
+            out_ += fmt::format("        case {}:goto I{};\n", site, alternate);
+        }
+    }
+    out_ += "        default:__builtin_unreachable();\n"
+            "    }\n";
+}
+
+void Transpiler::emit_instruction_(std::uint32_t index){
+    const Instruction &instruction = program_.instructions[index];
+    current_ = index;
+    out_ += "    rt.clock.count_operation();\n";
+    if(is_test(instruction.opcode)){
+        emit_test_(instruction);
+        return;
+    }
+    switch(instruction.opcode){
+        case Opcode::JUMP:out_ += fmt::format("    goto I{};\n", instruction.target);
+            return;
+        case Opcode::SWITCH:{
+            out_ += fmt::format("    switch({}){{\n", value_(instruction, 0));
+            for(std::uint32_t i = 0; i < instruction.operands[2]; i++){
+                const SwitchCase &switch_case = program_.cases[instruction.operands[3] + i];
+                if(index + 1 == switch_case.target){
+                    out_ += fmt::format("        case {}:break;\n", literal(switch_case.value));
+                } else{
+                    out_ += fmt::format("        case {}:goto I{};\n", literal(switch_case.value),
+                                        switch_case.target);
+                }
+            }
+            out_ += fmt::format("        default:goto I{};\n"
+                                "    }}\n", instruction.alternate);
+            return;
+        }
+        case Opcode::CALL:{
+            std::uint32_t site = 0;
+            while(call_sites_[site] != index){
+                site++;
+            }
+            out_ += fmt::format("    rt.calls.push_back({});\n"
+                                "    goto I{};\n"
+                                "R{}:;\n", site, instruction.target, site);
+            return;
+        }
+        case Opcode::RETURN_DONE:out_ += "    goto done_return;\n";
+            return;
+        case Opcode::RETURN_FAIL:out_ += "    goto fail_return;\n";
+            return;
+        case Opcode::HALT:out_ += "    return EXIT_DONE;\n";
+            return;
+        default:emit_operation_(instruction);
+            return;
+    }
+}
+
+void Transpiler::emit_test_(const Instruction &instruction){
+    std::string first = value_(instruction, 0);
+    std::string second = value_(instruction, 1);
+    std::string condition;
+    switch(instruction.opcode){
+        case Opcode::TEST_ONE_BITS:
+            condition = fmt::format("0 == ({} & ~{})", second, first);
+            break;
+        case Opcode::TEST_ZERO_BITS:
+            condition = fmt::format("0 == ({} & ~{})", first, second);
+            break;
+        default:
+            condition = fmt::format("{} {} {}", first, comparison(instruction.opcode), second);
+            break;
+    }
+    out_ += fmt::format((0 != (instruction.flags & INVERT)) ? "    if(!({})) goto I{};\n"
+                                                              : "    if({}) goto I{};\n",
+                        condition, instruction.target);
+}
+
+void Transpiler::emit_operation_(const Instruction &instruction){
+    unsigned count = instruction.operand_count;
+    const char *operation = binary_operation(instruction.opcode);
+    if(nullptr != operation){
+        std::string pattern;
+        for(const char *c = operation; '\0' != *c; c++){
+            if('#' == *c){
+                pattern += value_(instruction, 1);
+            } else{
+                pattern += *c;
+            }
+        }
+        update_(instruction, 0, pattern);
+        return;
+    }
+
+    std::array<std::string, 5> operands;
+    for(unsigned i = 0; i < count; i++){
+        const Operand &operand = program_.operand(instruction, i);
+        if(OperandKind::NONE != operand.kind){
+            operands[i] = value_(operand);
+        }
+    }
+    switch(instruction.opcode){
+        case Opcode::SETUP_STORAGE:
+            out_ += fmt::format("    rt.setup_storage({}, {}, {});\n", operands[0], operands[1],
+                                operands[2]);
+            break;
+        case Opcode::DEFINE_FIELD:
+            out_ += fmt::format("    rt.define_field({}, {}, {}, {});\n", instruction.field,
+                                operands[0], operands[1], operands[2]);
+            break;
+        case Opcode::GET_BLOCK:
+            out_ += fmt::format("    {{\n"
+                                "    Word old = {};\n"
+                                "    Word block = rt.get_block({}, {});\n",
+                                operands[0], program_.operand(instruction, 0).bug, operands[1]);
+            update_(instruction, 0, "block");
+            if(3 == count){
+                update_(instruction, 2, "old");
+            } else{
+                out_ += "    (void)old;\n";
+            }
+            out_ += "    }\n";
+            break;
+        case Opcode::GET_CHAIN:
+            update_(instruction, 0, fmt::format("rt.get_chain({}, {}, {}, {})",
+                                                program_.operand(instruction, 0).bug,
+                                                operands[1], operands[2], operands[3]));
+            break;
+        case Opcode::FREE_BLOCK:
+            out_ += fmt::format("    {{\n"
+                                "    Word replacement = {};\n"
+                                "    rt.free_block({});\n", operands[1], operands[0]);
+            update_(instruction, 0, "replacement");
+            out_ += "    }\n";
+            break;
+        case Opcode::DUPLICATE_BLOCK:
+            update_(instruction, 0, fmt::format("rt.duplicate_block({})", operands[1]));
+            break;
+        case Opcode::INTERCHANGE:
+            out_ += fmt::format("    {{\n"
+                                "    Word first = {};\n"
+                                "    Word second = {};\n", operands[0], operands[1]);
+            update_(instruction, 0, "second");
+            update_(instruction, 1, "first");
+            out_ += "    }\n";
+            break;
+        case Opcode::SHIFT_LEFT:[[fallthrough]];
+        case Opcode::SHIFT_RIGHT:{
+            // `(a, L, cd)` shifts `a` by `cd`; `(a, L, cd, co)` fills the bits vacated from `co`.
+            const char *shift = (Opcode::SHIFT_LEFT == instruction.opcode) ? "shift_left"
+                                                                            : "shift_right";
+            if(3 == count){
+                update_(instruction, 0, fmt::format("{}_filling($, {}, {})", shift, operands[1],
+                                                    operands[2]));
+            } else{
+                update_(instruction, 0, fmt::format("{}($, {})", shift, operands[1]));
+            }
+            break;
+        }
+        case Opcode::PRINT:
+            out_ += fmt::format("    rt.print({}, {});\n", operands[0], operands[1]);
+            break;
+        case Opcode::PUNCH:
+            out_ += fmt::format("    rt.punch({}, {});\n", operands[0], operands[1]);
+            break;
+        case Opcode::PRINT_LIST:
+            out_ += fmt::format("    rt.print_list({}, {}, {});\n", operands[0], operands[1],
+                                (3 == count) ? operands[2] : "0");
+            break;
+        case Opcode::X_RANGE:
+            out_ += fmt::format("    rt.x_range({}, {});\n", operands[0], operands[1]);
+            break;
+        case Opcode::Y_RANGE:
+            out_ += fmt::format("    rt.y_range({}, {});\n", operands[0], operands[1]);
+            break;
+        case Opcode::DRAW:
+            if(4 == count){
+                out_ += fmt::format("    rt.draw({}, {}, {}, {});\n", operands[0], operands[1],
+                                    operands[2], operands[3]);
+            } else{
+                out_ += fmt::format("    rt.draw({}, {});\n", operands[0], operands[1]);
+            }
+            break;
+        case Opcode::TYPE_HORIZONTALLY:[[fallthrough]];
+        case Opcode::TYPE_VERTICALLY:
+            out_ += fmt::format("    rt.type({}, {}, {}, {}, {});\n", operands[0], operands[1],
+                                operands[2], operands[3],
+                                Opcode::TYPE_VERTICALLY == instruction.opcode);
+            break;
+        case Opcode::DUMP:out_ += "    rt.dump();\n";
+            break;
+        case Opcode::STATE:out_ += "    rt.state();\n";
+            break;
+        case Opcode::ADVANCE:out_ += "    rt.advance();\n";
+            break;
+        case Opcode::SAVE_FIELD_CONTENTS:
+            out_ += fmt::format("    rt.save_contents({});\n", operands[0]);
+            break;
+        case Opcode::RESTORE_FIELD_CONTENTS:
+            update_(instruction, 0, "rt.restore_contents()");
+            break;
+        case Opcode::SAVE_FIELD_DEFINITION:
+            out_ += fmt::format("    rt.save_definition({});\n", instruction.field);
+            break;
+        case Opcode::RESTORE_FIELD_DEFINITION:
+            out_ += fmt::format("    rt.restore_definition({});\n", instruction.field);
+            break;
+        default:
+            out_ += fmt::format("    Runtime::fault(\"{} is not supported.\");\n",
+                                mnemonic(instruction.opcode));
+            break;
+    }
+}
+
+std::string Transpiler::accessor_(const char *access, unsigned field, bool checked) const{
+    const FieldDefinition *definition = constants_->constant(current_, field);
+    if(nullptr == definition || FieldLayout::STRADDLING == definition->layout){
+        return fmt::format("rt.{}{}", access, checked ? "" : "_unchecked");
+    }
+    return fmt::format("rt.{}_constant<{}, {}, {:#x}{}>", access, definition->word,
+                       definition->shift, definition->mask, checked ? "" : ", false");
+}
+
+std::string Transpiler::load_(const Operand &operand, unsigned i,
+                              const std::string &address) const{
+    unsigned field = program_.paths[operand.path + i];
+    return fmt::format("{}({}, {})", accessor_("load", field, i >= operand.unchecked), field,
+                       address);
+}
+
+std::string Transpiler::address_(const Operand &operand) const{
+    std::string address = fmt::format("bug[{}]", operand.bug);
+    for(unsigned i = 0; i + 1 < operand.length; i++){
+        address = load_(operand, i, address);
+    }
+    return address;
+}
+
+std::string Transpiler::value_(const Operand &operand) const{
+    switch(operand.kind){
+        case OperandKind::LITERAL:return literal(operand.value);
+        case OperandKind::BUG:return fmt::format("bug[{}]", operand.bug);
+        case OperandKind::FIELD:
+            return load_(operand, operand.length - 1u, address_(operand));
+        case OperandKind::CLOCK:return "rt.time()";
+        case OperandKind::AVAILABLE:return fmt::format("rt.available({})", literal(operand.value));
+        default:return "0";
+    }
+}
+
+void Transpiler::update_(const Operand &operand, const std::string &value){
+    switch(operand.kind){
+        case OperandKind::BUG:{
+            std::string bug = fmt::format("bug[{}]", operand.bug);
+            out_ += fmt::format("    {} = {};\n", bug, substitute(value, bug));
+            break;
+        }
+        case OperandKind::FIELD:{
+            unsigned last = operand.length - 1u;
+            unsigned field = program_.paths[operand.path + last];
+            out_ += fmt::format("    {{\n"
+                                "    Word address = {};\n"
+                                "    {}({}, address, {});\n"
+                                "    }}\n", address_(operand),
+                                accessor_("store", field, last >= operand.unchecked), field,
+                                substitute(value, load_(operand, last, "address")));
+            break;
+        }
+        default:
+            out_ += fmt::format("    Runtime::fault(\"Cannot store to {}.\");\n",
+                                program_.operand_name(operand));
+            break;
+    }
+}
+
+NativeCompilerOptions default_compiler_options(){
+    NativeCompilerOptions options;
+    const char *compiler = std::getenv("CXX");
+    options.compiler = (nullptr == compiler) ? "c++" : compiler;
+#if defined(ELSIX_RUNTIME_INCLUDE_DIRECTORY)
+    options.include_directory = ELSIX_RUNTIME_INCLUDE_DIRECTORY;
+#endif
+#if defined(ELSIX_RUNTIME_LIBRARY_DIRECTORY)
+    options.library_directory = ELSIX_RUNTIME_LIBRARY_DIRECTORY;
+#endif
+#if defined(ELSIX_RUNTIME_CHARACTER_SET)
+    options.character_set = ELSIX_RUNTIME_CHARACTER_SET;
+#endif
+    const char *flags = std::getenv("ELSIX_CXXFLAGS");
+    if(nullptr != flags){
+        options.extra_flags = flags;
+    }
+    return options;
+}
+
+bool write_translation(const std::string &source, const std::string &path){
+    std::ofstream file(path);
+    file << source;
+    return static_cast<bool>(file);
+}
+
+bool compile_native(const std::string &source_path, const std::string &output_path,
+                    const NativeCompilerOptions &options){
+    std::vector<std::string> arguments{options.compiler, "-std=c++17", options.optimization};
+    if(!options.include_directory.empty()){
+        arguments.push_back("-I" + options.include_directory);
+    }
+    if(!options.character_set.empty()){
+        arguments.push_back("-DELSIX_CHARACTER_SET_" + options.character_set + "=1");
+    }
+    std::istringstream extra(options.extra_flags);
+    for(std::string flag; extra >> flag;){
+        arguments.push_back(flag);
+    }
+    arguments.insert(arguments.end(), {source_path, "-o", output_path});
+    if(!options.library_directory.empty()){
+        arguments.push_back("-L" + options.library_directory);
+    }
+    arguments.insert(arguments.end(), {"-lelsixrt", "-lfmt", "-pthread"});
+
+    std::vector<char *> argv;
+    for(std::string &argument : arguments){
+        argv.push_back(argument.data());
+    }
+    argv.push_back(nullptr);
+
+    pid_t child;
+    if(0 != posix_spawnp(&child, argv[0], nullptr, nullptr, argv.data(), environ)){
+        return false;
+    }
+    int status;
+    if(waitpid(child, &status, 0) < 0){
+        return false;
+    }
+    return WIFEXITED(status) && 0 == WEXITSTATUS(status);
+}
+
+} // end namespace elsix
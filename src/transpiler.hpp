@@ -0,0 +1,131 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The ahead of time back end, which translates a program to a C++ translation unit that
+ * the system compiler builds into a native executable.
+ *
+ * Each instruction that is the target of a jump starts a basic block with its own C++ label, so
+ * a GOTO becomes a `goto` and the tests of an IF become conditional `goto`s. `(DO, s)` pushes a
+ * call site number on the runtime's call stack and jumps to `s`; DONE and FAIL pop it and
+ * return through a `switch` over the call sites. Operands are expanded inline into loads and
+ * stores of fields. Where `FieldConstants` proves a field has one definition, the word, shift,
+ * and mask of the definition are template arguments of the access, so the compiler reduces it
+ * to a shift and a mask; elsewhere the definition is looked up. Accesses the verifier has proven
+ * safe are emitted without checks. The result links against the runtime library `elsixrt`,
+ * which supplies storage management, input and output, and `main`.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fieldconstants.hpp"
+#include "program.hpp"
+
+namespace elsix{
+
+class Transpiler{
+public:
+    explicit Transpiler(const Program &program);
+
+    /// The complete translation unit.
+    [[nodiscard]] std::string translate();
+
+private:
+    const Program &program_;
+    std::string out_;
+    // Instructions that some jump, call, or return lands on.
+    std::vector<bool> targets_;
+    // The instruction index of each call site, by call site number.
+    std::vector<std::uint32_t> call_sites_;
+    std::unique_ptr<FieldConstants> constants_;
+    // The instruction being emitted.
+    std::uint32_t current_ = 0;
+
+    void find_targets_();
+    void emit_instruction_(std::uint32_t index);
+    void emit_test_(const Instruction &instruction);
+    void emit_operation_(const Instruction &instruction);
+    void emit_return_dispatch_(bool done);
+
+    /// The runtime function that does `access`, `load` or `store`, to field `field`.
+    [[nodiscard]] std::string accessor_(const char *access, unsigned field, bool checked) const;
+    /// An expression loading access `i` of the path of a field operand, at `address`.
+    [[nodiscard]] std::string load_(const Operand &operand, unsigned i,
+                                    const std::string &address) const;
+    [[nodiscard]] std::string value_(const Operand &operand) const;
+    [[nodiscard]] std::string value_(const Instruction &instruction, unsigned i) const{
+        return value_(program_.operand(instruction, i));
+    }
+    /// The address of the block holding the field an operand names.
+    [[nodiscard]] std::string address_(const Operand &operand) const;
+    /// Emits a statement storing `value` to `operand`. In `value`, `$` stands for the current
+    /// contents of the operand.
+    void update_(const Operand &operand, const std::string &value);
+    void update_(const Instruction &instruction, unsigned i, const std::string &value){
+        update_(program_.operand(instruction, i), value);
+    }
+};
+
+/// How to build a native executable from a translated program.
+struct NativeCompilerOptions{
+    /// The C++ compiler, `$CXX` or `c++` by default.
+    std::string compiler;
+    std::string optimization = "-O2";
+    /// Where `runtime.hpp` and the headers it includes are.
+    std::string include_directory;
+    /// Where `libelsixrt.a` is.
+    std::string library_directory;
+    /// The character set `libelsixrt.a` was built with, `ASCII`, `BCD`, or `GE635`, which the
+    /// program must be compiled with too.
+    std::string character_set;
+    /// Further flags, such as `-march=native`.
+    std::string extra_flags;
+};
+
+/// Options for the runtime library installed alongside this build of Elsix.
+[[nodiscard]] NativeCompilerOptions default_compiler_options();
+
+/// Writes a translation unit to `path`. Returns false if it cannot be written.
+bool write_translation(const std::string &source, const std::string &path);
+
+/**
+ * @brief Compiles the translation unit at `source_path` with the runtime library into the
+ * executable `output_path`.
+ * @return False if the compiler cannot be run or fails. Its own messages go to standard error.
+ */
+bool compile_native(const std::string &source_path, const std::string &output_path,
+                    const NativeCompilerOptions &options);
+
+} // end namespace elsix
@@ -0,0 +1,298 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "verifier.hpp"
+#include "controlflow.hpp"
+#include "fusion.hpp"
+
+namespace elsix{
+
+namespace{
+
+/// An extent no block is known to reach.
+constexpr Word UNBOUNDED = ~Word{0};
+
+/**
+ * @brief What is certain at the start of an instruction. `blocks` and `defined` are sets, one bit
+ * per bug or field. For a bug in `blocks`, `orders` holds the least order its block may have, and
+ * for a field in `defined`, `extents` the most words of a block it may reach.
+ */
+struct Facts{
+    Word blocks = 0;
+    Word defined = 0;
+    std::array<std::uint8_t, BUG_NAME_COUNT> orders{};
+    std::array<Word, FIELD_COUNT> extents{};
+};
+
+/// Where nothing has been reached yet: the identity of the intersection `merge` takes.
+Facts unreached() noexcept{
+    Facts facts{~Word{0}, ~Word{0}, {}, {}};
+    facts.orders.fill(0xff);
+    return facts;
+}
+
+constexpr Word bit(unsigned index) noexcept{
+    return Word{1} << index;
+}
+
+/// Does the instruction store to operand `i`?
+bool writes(const Instruction &instruction, unsigned i) noexcept{
+    switch(instruction.opcode){
+        case Opcode::INTERCHANGE:return i < 2;
+        case Opcode::GET_BLOCK:return 0 == i || (2 == i && 3 == instruction.operand_count);
+        default:return 0 == i && writes_operand0(instruction.opcode);
+    }
+}
+
+class Verifier{
+public:
+    explicit Verifier(const Program &program)
+        : program_(program), facts_(program.instructions.size(), unreached()),
+          reached_(program.instructions.size(), false){
+    }
+
+    void solve(){
+        if(program_.instructions.empty()){
+            return;
+        }
+        merge_(0, Facts{});
+        std::vector<std::uint32_t> pending{0};
+        std::vector<bool> is_pending(program_.instructions.size(), false);
+        is_pending[0] = true;
+        InstructionSuccessors next(program_);
+        std::vector<std::uint32_t> successors;
+        while(!pending.empty()){
+            std::uint32_t index = pending.back();
+            pending.pop_back();
+            is_pending[index] = false;
+            Facts out = transfer_(unfused(program_.instructions[index]), facts_[index]);
+            next.of(index, successors);
+            for(std::uint32_t successor : successors){
+                if(successor < program_.instructions.size() && merge_(successor, out)
+                   && !is_pending[successor]){
+                    is_pending[successor] = true;
+                    pending.push_back(successor);
+                }
+            }
+        }
+    }
+
+    /// Is the first access of operand `i` of instruction `index` safe?
+    [[nodiscard]] bool safe(std::uint32_t index, unsigned i) const{
+        const Instruction &instruction = program_.instructions[index];
+        const Operand &operand = program_.operand(instruction, i);
+        if(!reached_[index] || OperandKind::FIELD != operand.kind){
+            return false;
+        }
+        const Facts &facts = facts_[index];
+        unsigned field = program_.paths[operand.path];
+        if(0 == (facts.blocks & bit(operand.bug)) || 0 == (facts.defined & bit(field))
+           || facts.extents[field] > (Word{1} << facts.orders[operand.bug])){
+            return false;
+        }
+        // The bug must still hold the block when the operand is accessed.
+        Instruction first = unfused(instruction);
+        for(unsigned j = 0; j < first.operand_count; j++){
+            const Operand &other = program_.operand(first, j);
+            if(writes(first, j) && OperandKind::BUG == other.kind && other.bug == operand.bug){
+                return false;
+            }
+        }
+        if(first.opcode != instruction.opcode){
+            // The second part of a superinstruction runs after the first.
+            return false;
+        }
+        return true;
+    }
+
+private:
+    const Program &program_;
+    std::vector<Facts> facts_;
+    std::vector<bool> reached_;
+
+    bool merge_(std::uint32_t index, const Facts &in){
+        Facts &facts = facts_[index];
+        Facts merged{facts.blocks & in.blocks, facts.defined & in.defined, {}, {}};
+        for(unsigned bug = 0; bug < BUG_NAME_COUNT; bug++){
+            merged.orders[bug] = std::min(facts.orders[bug], in.orders[bug]);
+        }
+        for(unsigned field = 0; field < FIELD_COUNT; field++){
+            merged.extents[field] = std::max(facts.extents[field], in.extents[field]);
+        }
+        if(reached_[index] && merged.blocks == facts.blocks && merged.defined == facts.defined
+           && merged.orders == facts.orders && merged.extents == facts.extents){
+            return false;
+        }
+        reached_[index] = true;
+        facts = merged;
+        return true;
+    }
+
+    [[nodiscard]] Facts transfer_(const Instruction &instruction, Facts facts) const{
+        switch(instruction.opcode){
+            case Opcode::DEFINE_FIELD:
+                facts.defined |= bit(instruction.field);
+                facts.extents[instruction.field] = extent_(instruction);
+                return facts;
+            case Opcode::RESTORE_FIELD_DEFINITION:facts.defined &= ~bit(instruction.field);
+                return facts;
+            case Opcode::SETUP_STORAGE:[[fallthrough]];
+            case Opcode::FREE_BLOCK:facts.blocks = 0;
+                return facts;
+            default:break;
+        }
+
+        // What each bug stored to holds afterward, computed from the facts before.
+        Word holds = 0;
+        Word stored = 0;
+        std::array<std::uint8_t, BUG_NAME_COUNT> orders = facts.orders;
+        auto holds_block = [&](unsigned i){
+            const Operand &operand = program_.operand(instruction, i);
+            return OperandKind::BUG == operand.kind && 0 != (facts.blocks & bit(operand.bug));
+        };
+        auto order_of = [&](unsigned i){
+            return facts.orders[program_.operand(instruction, i).bug];
+        };
+        for(unsigned i = 0; i < instruction.operand_count; i++){
+            const Operand &operand = program_.operand(instruction, i);
+            if(!writes(instruction, i) || OperandKind::BUG != operand.kind){
+                continue;
+            }
+            bool block;
+            std::uint8_t order = 0;
+            switch(instruction.opcode){
+                case Opcode::GET_BLOCK:
+                    block = (0 == i) || holds_block(0);
+                    order = (0 == i) ? requested_order_(instruction) : order_of(0);
+                    break;
+                case Opcode::DUPLICATE_BLOCK:
+                    // A duplicate has the order of the block, whatever that is.
+                    block = true;
+                    order = holds_block(1) ? order_of(1) : 0;
+                    break;
+                case Opcode::SET_EQUAL:[[fallthrough]];
+                case Opcode::POINT:
+                    block = holds_block(1);
+                    order = block ? order_of(1) : 0;
+                    break;
+                case Opcode::INTERCHANGE:
+                    block = holds_block(1 - i);
+                    order = block ? order_of(1 - i) : 0;
+                    break;
+                default:block = false;
+                    break;
+            }
+            stored |= bit(operand.bug);
+            orders[operand.bug] = order;
+            holds = block ? (holds | bit(operand.bug)) : (holds & ~bit(operand.bug));
+        }
+        facts.blocks = (facts.blocks & ~stored) | holds;
+        facts.orders = orders;
+        return facts;
+    }
+
+    /// The order `(a, GT, cd)` asks for, if cd is a literal, or else the least order there is.
+    [[nodiscard]] std::uint8_t requested_order_(const Instruction &instruction) const{
+        const Operand &order = program_.operand(instruction, 1);
+        return (OperandKind::LITERAL == order.kind && order.value < WORD_BITS)
+               ? static_cast<std::uint8_t>(order.value) : 0;
+    }
+
+    /// How many words of a block the field a Df defines reaches, if its operands are literals.
+    [[nodiscard]] Word extent_(const Instruction &instruction) const{
+        std::array<Word, 3> values{};
+        for(unsigned i = 0; i < values.size(); i++){
+            const Operand &operand = program_.operand(instruction, i);
+            if(OperandKind::LITERAL != operand.kind || operand.value > 0xffff){
+                return UNBOUNDED;
+            }
+            values[i] = operand.value;
+        }
+        if(!FieldDefinition::valid(static_cast<unsigned>(values[1]),
+                                   static_cast<unsigned>(values[2]))){
+            return UNBOUNDED;
+        }
+        return FieldDefinition(static_cast<unsigned>(values[0]), static_cast<unsigned>(values[1]),
+                               static_cast<unsigned>(values[2])).extent();
+    }
+};
+
+} // end anonymous namespace
+
+bool parse_checks(std::string_view text, Checks &checks) noexcept{
+    if("full" == text){
+        checks = Checks::FULL;
+    } else if("proven" == text){
+        checks = Checks::PROVEN;
+    } else if("none" == text){
+        checks = Checks::NONE;
+    } else{
+        return false;
+    }
+    return true;
+}
+
+std::size_t verify(Program &program, Checks checks){
+    for(Operand &operand : program.operands){
+        operand.unchecked = 0;
+    }
+    std::size_t marked = 0;
+    if(Checks::NONE == checks){
+        for(Operand &operand : program.operands){
+            if(OperandKind::FIELD == operand.kind){
+                operand.unchecked = operand.length;
+                marked += operand.length;
+            }
+        }
+        return marked;
+    }
+    if(Checks::FULL == checks){
+        return 0;
+    }
+
+    Verifier verifier(program);
+    verifier.solve();
+    for(std::uint32_t index = 0; index < program.instructions.size(); index++){
+        const Instruction &instruction = program.instructions[index];
+        for(unsigned i = 0; i < instruction.operand_count; i++){
+            if(verifier.safe(index, i)){
+                program.operands[instruction.operands[i]].unchecked = 1;
+                marked++;
+            }
+        }
+    }
+    return marked;
+}
+
+} // end namespace elsix
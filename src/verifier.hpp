@@ -0,0 +1,84 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief The verifier, which proves where the runtime checks on field accesses cannot fail, so
+ * that the back ends can leave them out there.
+ *
+ * Before it reads or writes a field of a block, the runtime checks that the address is not zero
+ * and lies in a region set up by SS, that the field has been defined, and that the block is large
+ * enough to hold the field's word, and the next word if the field straddles into it. The verifier
+ * runs a forward analysis over the instructions of the program that finds, at the start of each
+ * instruction, the bugs that certainly hold the address of a block and the fields that are
+ * certainly defined, on every path that reaches it, with the least order of each block and the
+ * most words of a block each field may reach:
+ *
+ *  - A bug holds a block once GT or DP stores a new block in it, or E, P, or IC copies one from
+ *    another such bug, until anything else is stored in it. A GT of a literal order gives a
+ *    block of that order, a DP one of the order of its source, and any other GT one of order 0.
+ *    FR undoes this for every bug, since any of them may hold the block freed, and the pages of
+ *    a freed large block are made inaccessible. Setting up storage again undoes it too.
+ *  - A field is defined once a Df defines it, which faults if it cannot, until an FD restores a
+ *    definition that may be no definition at all. Only a Df of literals bounds the words it
+ *    reaches.
+ *
+ * The first access of an operand such as `XDB`, which reads field D of the block X holds, needs
+ * no checks where X holds a block that reaches D and D is defined, unless the instruction stores
+ * to X before it accesses the operand. Later accesses of the path go through addresses read from
+ * storage and keep their checks. The verifier records how many accesses need no checks in
+ * `Operand::unchecked`, which the interpreter and the translator read.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "program.hpp"
+
+namespace elsix{
+
+/// Which field accesses are checked, set by `--checks`.
+enum class Checks{
+    FULL,   // Every access.
+    PROVEN, // Every access the verifier cannot prove safe.
+    NONE    // None. A program that would fault has undefined behavior instead.
+};
+
+/// Parses `full`, `proven`, or `none`. Returns false for anything else.
+bool parse_checks(std::string_view text, Checks &checks) noexcept;
+
+/**
+ * @brief Marks the field accesses of the program that are not to be checked under `checks`.
+ * @return The number of accesses marked.
+ */
+std::size_t verify(Program &program, Checks checks);
+
+} // end namespace elsix
@@ -0,0 +1,351 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief A minimal x86-64 instruction encoder for the JIT, covering only the instructions it
+ * emits: 64 bit moves, loads, and stores, integer arithmetic and logic, compares, and jumps.
+ *
+ * Memory operands are a base register plus a 32 bit displacement, optionally with an index
+ * register scaled by 8. Forward jumps are emitted with a 32 bit displacement and patched once
+ * their target is known.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace elsix{
+
+enum class Reg: std::uint8_t{
+    RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9, R10, R11, R12, R13, R14, R15
+};
+
+/// Condition codes, as the low nibble of `Jcc`.
+enum class Condition: std::uint8_t{
+    BELOW = 0x2,
+    ABOVE_OR_EQUAL = 0x3,
+    EQUAL = 0x4,
+    NOT_EQUAL = 0x5,
+    ABOVE = 0x7
+};
+
+constexpr Condition negate(Condition condition) noexcept{
+    return static_cast<Condition>(static_cast<std::uint8_t>(condition) ^ 1);
+}
+
+class X86Emitter{
+public:
+    /// The position of a 32 bit displacement to patch.
+    using Patch = std::size_t;
+
+    [[nodiscard]] const std::vector<std::uint8_t> &code() const noexcept{
+        return code_;
+    }
+
+    [[nodiscard]] std::size_t position() const noexcept{
+        return code_.size();
+    }
+
+    // region: Moves
+
+    void mov(Reg destination, Reg source){
+        alu_(0x89, destination, source);
+    }
+
+    /// Uses the shortest encoding for the value.
+    void mov(Reg destination, std::uint64_t value){
+        if(value <= 0xffffffff){
+            // A 32 bit move zero extends.
+            rex_(false, 0, 0, code(destination));
+            byte(0xb8 + low(destination));
+            imm32(static_cast<std::uint32_t>(value));
+        } else{
+            rex_(true, 0, 0, code(destination));
+            byte(0xb8 + low(destination));
+            imm64(value);
+        }
+    }
+
+    /// destination = [base + displacement]
+    void load(Reg destination, Reg base, std::int32_t displacement){
+        memory_(0x8b, code(destination), base, displacement);
+    }
+
+    /// [base + displacement] = source
+    void store(Reg base, std::int32_t displacement, Reg source){
+        memory_(0x89, code(source), base, displacement);
+    }
+
+    /// destination = [base + index * 8 + displacement]
+    void load_indexed(Reg destination, Reg base, Reg index, std::int32_t displacement){
+        indexed_(0x8b, code(destination), base, index, displacement);
+    }
+
+    /// destination = the byte at [base + index], zero extended.
+    void load_byte(Reg destination, Reg base, Reg index){
+        rex_(false, code(destination), code(index), code(base));
+        byte(0x0f);
+        byte(0xb6);
+        // Always a disp8, as for `test_byte`.
+        modrm_(1, code(destination), 4);
+        byte(static_cast<std::uint8_t>((low(index) << 3) | low(base)));
+        byte(0);
+    }
+
+    /// [base + index * 8 + displacement] = source
+    void store_indexed(Reg base, Reg index, std::int32_t displacement, Reg source){
+        indexed_(0x89, code(source), base, index, displacement);
+    }
+
+    // endregion: Moves
+
+    // region: Arithmetic and logic
+
+    void add(Reg destination, Reg source){
+        alu_(0x01, destination, source);
+    }
+
+    void sub(Reg destination, Reg source){
+        alu_(0x29, destination, source);
+    }
+
+    void and_(Reg destination, Reg source){
+        alu_(0x21, destination, source);
+    }
+
+    void or_(Reg destination, Reg source){
+        alu_(0x09, destination, source);
+    }
+
+    void xor_(Reg destination, Reg source){
+        alu_(0x31, destination, source);
+    }
+
+    void cmp(Reg first, Reg second){
+        alu_(0x39, first, second);
+    }
+
+    void test(Reg first, Reg second){
+        alu_(0x85, first, second);
+    }
+
+    void imul(Reg destination, Reg source){
+        rex_(true, code(destination), 0, code(source));
+        byte(0x0f);
+        byte(0xaf);
+        modrm_(3, code(destination), code(source));
+    }
+
+    void not_(Reg destination){
+        rex_(true, 0, 0, code(destination));
+        byte(0xf7);
+        modrm_(3, 2, code(destination));
+    }
+
+    void shl(Reg destination, std::uint8_t bits){
+        shift_(4, destination, bits);
+    }
+
+    void shr(Reg destination, std::uint8_t bits){
+        shift_(5, destination, bits);
+    }
+
+    /// destination &= value, sign extended from 32 bits.
+    void and_(Reg destination, std::int32_t value){
+        rex_(true, 0, 0, code(destination));
+        byte(0x81);
+        modrm_(3, 4, code(destination));
+        imm32(static_cast<std::uint32_t>(value));
+    }
+
+    /// Compares with `value`, sign extended from 32 bits.
+    void cmp(Reg first, std::int32_t value){
+        rex_(true, 0, 0, code(first));
+        byte(0x81);
+        modrm_(3, 7, code(first));
+        imm32(static_cast<std::uint32_t>(value));
+    }
+
+    /// Tests `bits` of the byte at [base + index].
+    void test_byte(Reg base, Reg index, std::uint8_t bits){
+        rex_(false, 0, code(index), code(base), true);
+        byte(0xf6);
+        // Always a disp8, so that RBP and R13 can be the base.
+        modrm_(1, 0, 4);
+        byte(static_cast<std::uint8_t>((low(index) << 3) | low(base)));
+        byte(0);
+        byte(bits);
+    }
+
+    /// Adds `value`, below 2^31, to the word at [base].
+    void add_to(Reg base, std::uint32_t value){
+        rex_(true, 0, 0, code(base));
+        byte(value <= 0x7f ? 0x83 : 0x81);
+        modrm_(1, 0, 4 == low(base) ? 4 : low(base));
+        if(4 == low(base)){
+            byte(0x24);
+        }
+        byte(0);
+        if(value <= 0x7f){
+            byte(static_cast<std::uint8_t>(value));
+        } else{
+            imm32(value);
+        }
+    }
+
+    // endregion: Arithmetic and logic
+
+    // region: Control
+
+    [[nodiscard]] Patch jump(){
+        byte(0xe9);
+        return placeholder_();
+    }
+
+    [[nodiscard]] Patch jump(Condition condition){
+        byte(0x0f);
+        byte(0x80 | static_cast<std::uint8_t>(condition));
+        return placeholder_();
+    }
+
+    void jump_to(std::size_t target){
+        patch(jump(), target);
+    }
+
+    void jump_to(Condition condition, std::size_t target){
+        patch(jump(condition), target);
+    }
+
+    /// Makes the jump at `patch` land on `target`.
+    void patch(Patch patch, std::size_t target){
+        auto displacement = static_cast<std::int32_t>(static_cast<std::int64_t>(target)
+                                                      - static_cast<std::int64_t>(patch + 4));
+        std::memcpy(&code_[patch], &displacement, 4);
+    }
+
+    void push(Reg reg){
+        rex_(false, 0, 0, code(reg));
+        byte(0x50 + low(reg));
+    }
+
+    void pop(Reg reg){
+        rex_(false, 0, 0, code(reg));
+        byte(0x58 + low(reg));
+    }
+
+    void ret(){
+        byte(0xc3);
+    }
+
+    // endregion: Control
+
+    void byte(std::uint8_t value){
+        code_.push_back(value);
+    }
+
+    void imm32(std::uint32_t value){
+        for(unsigned i = 0; i < 4; i++){
+            byte(static_cast<std::uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void imm64(std::uint64_t value){
+        imm32(static_cast<std::uint32_t>(value));
+        imm32(static_cast<std::uint32_t>(value >> 32));
+    }
+
+private:
+    std::vector<std::uint8_t> code_;
+
+    static constexpr unsigned code(Reg reg) noexcept{
+        return static_cast<unsigned>(reg);
+    }
+
+    static constexpr std::uint8_t low(Reg reg) noexcept{
+        return static_cast<std::uint8_t>(static_cast<unsigned>(reg) & 7);
+    }
+
+    /// Emits a REX prefix if one is needed. `reg`, `index`, and `base` are full register codes.
+    void rex_(bool wide, unsigned reg, unsigned index, unsigned base, bool force = false){
+        std::uint8_t rex = static_cast<std::uint8_t>(0x40 | (wide ? 8 : 0) | ((reg >> 3) << 2)
+                                                     | ((index >> 3) << 1) | (base >> 3));
+        if(0x40 != rex || force){
+            byte(rex);
+        }
+    }
+
+    void modrm_(unsigned mod, unsigned reg, unsigned rm){
+        byte(static_cast<std::uint8_t>((mod << 6) | ((reg & 7) << 3) | (rm & 7)));
+    }
+
+    /// `op r/m64, r64` between registers.
+    void alu_(std::uint8_t opcode, Reg rm, Reg reg){
+        rex_(true, code(reg), 0, code(rm));
+        byte(opcode);
+        modrm_(3, code(reg), code(rm));
+    }
+
+    void shift_(unsigned extension, Reg destination, std::uint8_t bits){
+        rex_(true, 0, 0, code(destination));
+        byte(0xc1);
+        modrm_(3, extension, code(destination));
+        byte(bits);
+    }
+
+    void memory_(std::uint8_t opcode, unsigned reg, Reg base, std::int32_t displacement){
+        rex_(true, reg, 0, code(base));
+        byte(opcode);
+        modrm_(2, reg, low(base));
+        if(4 == low(base)){
+            // RSP and R12 as a base need a SIB byte.
+            byte(0x24);
+        }
+        imm32(static_cast<std::uint32_t>(displacement));
+    }
+
+    void indexed_(std::uint8_t opcode, unsigned reg, Reg base, Reg index,
+                  std::int32_t displacement){
+        rex_(true, reg, code(index), code(base));
+        byte(opcode);
+        modrm_(2, reg, 4);
+        byte(static_cast<std::uint8_t>(0xc0 | (low(index) << 3) | low(base)));
+        imm32(static_cast<std::uint32_t>(displacement));
+    }
+
+    Patch placeholder_(){
+        Patch patch = code_.size();
+        imm32(0);
+        return patch;
+    }
+};
+
+} // end namespace elsix
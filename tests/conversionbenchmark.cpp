@@ -0,0 +1,115 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Times the conversion kernels of conversion.hpp against their `_reference` loops, in the
+ * character set of the build.
+ *
+ *     conversion_benchmark [words [rounds]]
+ *
+ * Each conversion is applied to `words` words from its domain `rounds` times over. The results
+ * are summed so that the compiler cannot drop the work, and reported in nanoseconds per word.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "conversion.hpp"
+
+namespace{
+
+using namespace elsix;
+
+/// A word of characters with codes in `[low, high]`.
+Word characters(std::mt19937_64 &random, Word low, Word high){
+    std::uniform_int_distribution<Word> code(low, high);
+    Word word = 0;
+    for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+        word |= code(random) << (lane * CHARACTER_BITS);
+    }
+    return word;
+}
+
+/// Nanoseconds per word of `Convert` over `inputs`, adding the results to `sink`. The
+/// conversion is a template argument so that it is inlined, as it is where the runtime calls it.
+template<Word (*Convert)(Word)>
+double time(const std::vector<Word> &inputs, std::size_t rounds, Word &sink){
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t round = 0; round < rounds; round++){
+        for(Word input : inputs){
+            sink += Convert(input);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(inputs.size() * rounds);
+}
+
+template<Word (*Kernel)(Word), Word (*Reference)(Word)>
+void report(const char *operation, const std::vector<Word> &inputs, std::size_t rounds,
+            Word &sink){
+    double kernel_time = time<Kernel>(inputs, rounds, sink);
+    double reference_time = time<Reference>(inputs, rounds, sink);
+    std::cout << operation << std::fixed << std::setprecision(2)
+              << std::setw(10) << kernel_time << std::setw(12) << reference_time
+              << std::setw(9) << reference_time / kernel_time << "x\n";
+}
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[]){
+    std::size_t words = (argc > 1) ? std::stoul(argv[1]) : 4096;
+    std::size_t rounds = (argc > 2) ? std::stoul(argv[2]) : 2000;
+
+    constexpr const CharacterSet &set = DEFAULT_CHARACTERS;
+    std::mt19937_64 random(6);
+    std::vector<Word> any, decimal, octal;
+    for(std::size_t i = 0; i < words; i++){
+        any.push_back(random());
+        decimal.push_back(characters(random, set.zero, set.zero + 9));
+        octal.push_back(characters(random, set.zero, set.zero + 7));
+    }
+
+    Word sink = 0;
+    std::cout << "   kernel ns   reference ns  speedup\n";
+    report<blanks_to_zeroes, blanks_to_zeroes_reference>("BZ", any, rounds, sink);
+    report<zeroes_to_blanks, zeroes_to_blanks_reference>("ZB", any, rounds, sink);
+    report<binary_to_decimal, binary_to_decimal_reference>("BD", any, rounds, sink);
+    report<decimal_to_binary, decimal_to_binary_reference>("DB", decimal, rounds, sink);
+    report<binary_to_octal, binary_to_octal_reference>("BO", any, rounds, sink);
+    report<octal_to_binary, octal_to_binary_reference>("OB", octal, rounds, sink);
+    // Nothing reads the sum, but printing it keeps every conversion live.
+    std::cout << "(" << sink % 10 << ")" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,193 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Checks the conversion kernels of conversion.hpp against their `_reference` loops, for
+ * every character set, on edge cases and random words.
+ *
+ *     conversions [words [seed]]
+ *
+ * Every kernel is defined for any word, `DB` and `OB` counting a character below zero as 0, but
+ * arbitrary words are rarely digits, so those two also get words drawn from their domains, and
+ * `DB` numbers padded with blanks, as `ZB` leaves them. Exits with a nonzero status if any result
+ * differs.
+ */
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "conversion.hpp"
+
+namespace{
+
+using namespace elsix;
+
+class ConversionCheck{
+public:
+    ConversionCheck(std::size_t words, std::uint64_t seed) : words_(words), random_(seed){}
+
+    /// Checks every conversion for one character set. Returns false if any result differs.
+    template<const CharacterSet &Characters>
+    bool check(const char *set_name){
+        set_name_ = set_name;
+        std::vector<Word> any = edge_cases<Characters>();
+        std::vector<Word> decimal = any;
+        std::vector<Word> octal = any;
+        for(std::size_t i = 0; i < words_; i++){
+            any.push_back(random_());
+            decimal.push_back(characters(Characters.zero, Characters.zero + 9));
+            octal.push_back(characters(Characters.zero, CHARACTER_MASK));
+        }
+        // Only in-domain edge cases stay in the restricted inputs.
+        erase_outside(decimal, Characters.zero, Characters.zero + 9);
+        erase_outside(octal, Characters.zero, CHARACTER_MASK);
+
+        return compare("BZ", any, blanks_to_zeroes<Characters>,
+                       blanks_to_zeroes_reference<Characters>)
+            && compare("ZB", any, zeroes_to_blanks<Characters>,
+                       zeroes_to_blanks_reference<Characters>)
+            && compare("BD", any, binary_to_decimal<Characters>,
+                       binary_to_decimal_reference<Characters>)
+            && compare("BO", any, binary_to_octal<Characters>,
+                       binary_to_octal_reference<Characters>)
+            && compare("DB", any, decimal_to_binary<Characters>,
+                       decimal_to_binary_reference<Characters>)
+            && compare("DB", decimal, decimal_to_binary<Characters>,
+                       decimal_to_binary_reference<Characters>)
+            && compare("OB", any, octal_to_binary<Characters>,
+                       octal_to_binary_reference<Characters>)
+            && compare("OB", octal, octal_to_binary<Characters>,
+                       octal_to_binary_reference<Characters>)
+            && check_padded<Characters>();
+    }
+
+private:
+    std::size_t words_;
+    std::mt19937_64 random_;
+    const char *set_name_ = "";
+
+    /// A word of characters with codes in `[low, high]`, and random bits above them.
+    Word characters(Word low, Word high){
+        std::uniform_int_distribution<Word> code(low, high);
+        Word word = random_() & ~CHARACTER_LANES;
+        for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+            word |= code(random_) << (lane * CHARACTER_BITS);
+        }
+        return word;
+    }
+
+    /// Words of all blanks, all zeroes, and runs of each with one other character, and the
+    /// values at the ends of the decimal and octal ranges.
+    template<const CharacterSet &Characters>
+    static std::vector<Word> edge_cases(){
+        std::vector<Word> words{0, ~Word{0}, CHARACTER_LANES, 9999999999ULL, 10000000000ULL,
+                                07777777777ULL, 010000000000ULL};
+        for(Word fill : {Word{Characters.blank}, Word{Characters.zero}}){
+            words.push_back(broadcast(fill));
+            for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+                for(Word code : {Word{0}, Word{Characters.zero + 1}, CHARACTER_MASK}){
+                    Word shift = lane * CHARACTER_BITS;
+                    words.push_back((broadcast(fill) & ~(CHARACTER_MASK << shift))
+                                    | (code << shift));
+                }
+            }
+        }
+        return words;
+    }
+
+    /// Where a blank is below zero, as in ASCII, `DB` of a number with its leading zeroes blanked
+    /// must still be the number, since a blank counts as 0.
+    template<const CharacterSet &Characters>
+    bool check_padded(){
+        if(Characters.blank >= Characters.zero){
+            return true;
+        }
+        std::vector<Word> numbers{0, 7, 42, 1000, 9999999999ULL};
+        for(std::size_t i = 0; i < words_; i++){
+            numbers.push_back(random_() % (Word{1} << (random_() % 34)));
+        }
+        for(Word number : numbers){
+            Word padded = zeroes_to_blanks<Characters>(binary_to_decimal<Characters>(number));
+            Word value = decimal_to_binary<Characters>(padded);
+            if(value != number){
+                std::cerr << set_name_ << " DB of " << std::oct << padded << std::dec
+                          << " is " << value << " instead of " << number << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void erase_outside(std::vector<Word> &words, Word low, Word high){
+        std::vector<Word> kept;
+        for(Word word : words){
+            bool inside = true;
+            for(unsigned lane = 0; lane < CONVERSION_DIGITS; lane++){
+                Word code = (word >> (lane * CHARACTER_BITS)) & CHARACTER_MASK;
+                inside = inside && low <= code && code <= high;
+            }
+            if(inside){
+                kept.push_back(word);
+            }
+        }
+        words = std::move(kept);
+    }
+
+    bool compare(const char *operation, const std::vector<Word> &inputs, Word (*kernel)(Word),
+                 Word (*reference)(Word)) const{
+        for(Word input : inputs){
+            Word expected = reference(input);
+            Word actual = kernel(input);
+            if(actual != expected){
+                std::cerr << std::oct << set_name_ << " " << operation << " of " << input
+                          << " is " << actual << " instead of " << expected << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[]){
+    std::size_t words = (argc > 1) ? std::stoul(argv[1]) : 100000;
+    std::uint64_t seed = (argc > 2) ? std::stoull(argv[2]) : 6;
+
+    ConversionCheck check(words, seed);
+    bool passed = check.check<ASCII_CHARACTERS>("ASCII")
+               && check.check<BCD_CHARACTERS>("BCD")
+               && check.check<GE635_CHARACTERS>("GE635");
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,115 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief Checks that `load_image` refuses images whose checksum is right but whose program the
+ * back ends could not run safely: a superinstruction, which only fusion makes after an image is
+ * written, and a Get Chain whose packed link fields are not fields.
+ *
+ *     images [directory]
+ *
+ * Each program is written with `save_image`, so its checksum matches, and read back. Exits with a
+ * nonzero status if any image loads when it should not, or a good one does not.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "image.hpp"
+
+namespace{
+
+using namespace elsix;
+
+/// `(X, GL, 0, 2, f)` and HALT, with `fields` as the packed field operand.
+Program get_chain(Word fields){
+    Program program;
+    program.operands.resize(4);
+    program.operands[0].kind = OperandKind::BUG;
+    program.operands[0].bug = 'X' - 'A';
+    for(unsigned i = 1; i < 4; i++){
+        program.operands[i].kind = OperandKind::LITERAL;
+    }
+    program.operands[2].value = 2;
+    program.operands[3].value = fields;
+
+    Instruction chain;
+    chain.opcode = Opcode::GET_CHAIN;
+    chain.operand_count = 4;
+    chain.operands = {0, 1, 2, 3, 0};
+    program.instructions.push_back(chain);
+    program.instructions.push_back(Instruction{});
+    program.lines.push_back(LineInfo{});
+    return program;
+}
+
+/// Writes `program` as an image and reads it back. Returns false if the status is not `expected`.
+bool round_trip(const std::string &path, const char *name, const Program &program,
+                ImageStatus expected){
+    if(!save_image(program, path)){
+        std::cerr << "Cannot write " << path << std::endl;
+        return false;
+    }
+    Program loaded;
+    ImageStatus status = load_image(path, loaded);
+    std::remove(path.c_str());
+    if(expected != status){
+        std::cerr << name << ": expected status " << static_cast<int>(expected) << ", got "
+                  << static_cast<int>(status) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[]){
+    std::string path = std::string((argc > 1) ? argv[1] : ".") + "/images_test.l6c";
+    Word link_a = field_index('A') + 1;
+    Word link_b = field_index('B') + 1;
+
+    Program fused = get_chain(link_a);
+    fused.instructions[0].opcode = Opcode::GET_BLOCK_AND_LINK;
+    fused.instructions[0].operands[3] = 3;
+
+    bool passed = round_trip(path, "GL through A", get_chain(link_a), ImageStatus::LOADED)
+               && round_trip(path, "GL through A and B", get_chain(link_a | link_b << 8),
+                             ImageStatus::LOADED)
+               && round_trip(path, "GL with no link", get_chain(0), ImageStatus::DAMAGED)
+               && round_trip(path, "GL through field 99", get_chain(99), ImageStatus::DAMAGED)
+               && round_trip(path, "GL with back link 99", get_chain(link_a | Word{99} << 8),
+                             ImageStatus::DAMAGED)
+               && round_trip(path, "GL with a third field", get_chain(link_a | link_b << 16),
+                             ImageStatus::DAMAGED)
+               && round_trip(path, "fused GT", fused, ImageStatus::DAMAGED);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
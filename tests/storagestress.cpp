@@ -0,0 +1,246 @@
+/*
+    Created by Robert Jacobson on 19 October 2026.
+
+    Elsix
+    Description: An implementation of the Bell Telephone Laboratories'
+                 Low-Level Linked List Language L6.
+
+    Copyright (c) 2019 Robert Jacobson.
+        The MIT License
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+    deal in the Software without restriction, including without limitation the
+    rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+    sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+    IN THE SOFTWARE.
+
+    */
+
+/**
+ * @brief A stress test of the storage region: random sequences of Get Block, Get Chain, Free
+ * Block, and Duplicate Block, with and without copy-on-write, checking after every step that the
+ * counts behind `n.` agree with the free maps and free large block ranges.
+ *
+ *     storage_stress [steps [seed]]
+ *
+ * Every block holds a stamp in its first and last words, checked when it is freed and
+ * periodically for all live blocks, so that blocks handed out twice or contents lost by
+ * copy-on-write show up as well. Exits with a nonzero status on the first failure.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "storageregion.hpp"
+
+namespace{
+
+using elsix::Word;
+
+/// The buddy system's blocks are at most 2^SMALL_ORDER words, and blocks up to 2^MAX_ORDER words
+/// are large blocks, so both allocators and the boundary between them are exercised.
+constexpr unsigned SMALL_ORDER = 5;
+constexpr unsigned MAX_ORDER = 10;
+constexpr Word FIRST_WORD = 0100;
+constexpr Word BUDDY_WORDS = Word{1} << 12;
+/// Small enough that the window runs out of room for large blocks.
+constexpr Word LARGE_WINDOW = Word{1} << 15;
+/// How often every live block's stamp is checked, in steps.
+constexpr std::size_t SWEEP_INTERVAL = 256;
+
+struct Block{
+    Word address;
+    unsigned order;
+    Word stamp;
+};
+
+class Stress{
+public:
+    Stress(std::uint32_t seed, bool copy_on_write) : random_(seed){
+        region_.set_small_block_limit(SMALL_ORDER);
+        region_.set_large_block_window(LARGE_WINDOW);
+        region_.set_copy_on_write(copy_on_write);
+        region_.setup(FIRST_WORD, MAX_ORDER, FIRST_WORD + BUDDY_WORDS - 1);
+    }
+
+    /// Runs `steps` random operations. Returns false at the first failed check.
+    bool run(std::size_t steps){
+        for(std::size_t step = 0; step < steps; step++){
+            // Fill storage until a get fails, then mostly free until few blocks are left, so
+            // that storage is repeatedly exhausted and recovered.
+            if(filling_ ? exhausted_ : live_.size() < 16){
+                filling_ = !filling_;
+                exhausted_ = false;
+            }
+            unsigned choice = pick(0, 9);
+            bool passed = (live_.empty() || (filling_ ? choice < 8 : choice < 3))
+                          ? (0 == choice % 3 ? get_chain() : 1 == choice % 3 ? duplicate_block()
+                                                                             : get_block())
+                          : free_block();
+            if(!passed || !check("the available counts", region_.verify_available_counts())
+                || (0 == step % SWEEP_INTERVAL && !sweep())){
+                std::cerr << "at step " << step << "\n";
+                return false;
+            }
+        }
+        while(!live_.empty()){
+            if(!free_block() || !check("the available counts", region_.verify_available_counts())){
+                return false;
+            }
+        }
+        // With everything freed, storage is whole again.
+        return check("storage is whole after freeing every block",
+                     region_.available_blocks(0) == BUDDY_WORDS);
+    }
+
+private:
+    elsix::StorageRegion region_;
+    std::mt19937 random_;
+    std::vector<Block> live_;
+    Word next_stamp_ = 1;
+    bool filling_ = true;
+    // Whether a get has failed since `filling_` last changed.
+    bool exhausted_ = false;
+
+    unsigned pick(unsigned low, unsigned high){
+        return std::uniform_int_distribution<unsigned>(low, high)(random_);
+    }
+
+    static bool check(const char *what, bool holds){
+        if(!holds){
+            std::cerr << "Failed: " << what << " ";
+        }
+        return holds;
+    }
+
+    void stamp(Block &block){
+        block.stamp = next_stamp_++;
+        Word *words = region_.resolve_for_write(block.address);
+        words[0] = block.stamp;
+        words[(Word{1} << block.order) - 1] = block.stamp;
+    }
+
+    bool stamped(const Block &block) const{
+        const Word *words = region_.resolve(block.address);
+        return check("a block is not a block", region_.is_block(block.address))
+            && check("a block changed order", region_.order_of(block.address) == block.order)
+            && check("a block lost its stamp", nullptr != words && words[0] == block.stamp
+                     && words[(Word{1} << block.order) - 1] == block.stamp);
+    }
+
+    bool sweep() const{
+        for(const Block &block : live_){
+            if(!stamped(block)){
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// An order, favoring small blocks as programs do.
+    unsigned pick_order(){
+        return pick(0, pick(0, MAX_ORDER));
+    }
+
+    bool get_block(){
+        unsigned order = pick_order();
+        Word available = region_.available_blocks(order);
+        Block block{region_.get_block(order), order, 0};
+        // `n.` promises exactly whether a Get Block can succeed.
+        if(!check("Get Block disagrees with n.", (0 == block.address) == (0 == available))){
+            return false;
+        }
+        exhausted_ |= (0 == block.address);
+        if(0 != block.address){
+            if(!check("a new block is not zero", 0 == region_.resolve(block.address)[0])){
+                return false;
+            }
+            stamp(block);
+            live_.push_back(block);
+        }
+        return true;
+    }
+
+    bool get_chain(){
+        unsigned order = pick_order();
+        std::size_t count = pick(1, 40);
+        // The link is a whole word, as the large block window lies above any shorter field.
+        elsix::FieldDefinition link(0, 0, elsix::WORD_BITS - 1);
+        Word address = region_.get_chain(order, count, link);
+        exhausted_ |= (0 == address);
+        for(std::size_t i = 0; 0 != address; i++){
+            if(!check("a chain is too long", i < count)){
+                return false;
+            }
+            Block block{address, order, 0};
+            address = link.load(region_.resolve(address));
+            stamp(block);
+            live_.push_back(block);
+        }
+        return true;
+    }
+
+    bool duplicate_block(){
+        if(live_.empty()){
+            return true;
+        }
+        Block source = live_[pick(0, static_cast<unsigned>(live_.size() - 1))];
+        Block duplicate{region_.duplicate_block(source.address), source.order, source.stamp};
+        if(0 == duplicate.address){
+            exhausted_ = true;
+            return true;
+        }
+        live_.push_back(duplicate);
+        if(!stamped(duplicate)){
+            return false;
+        }
+        // Writing to either side of a copy-on-write pair must leave the other intact.
+        if(0 == pick(0, 1)){
+            stamp(live_.back());
+        }
+        return true;
+    }
+
+    bool free_block(){
+        std::size_t index = pick(0, static_cast<unsigned>(live_.size() - 1));
+        Block block = live_[index];
+        live_[index] = live_.back();
+        live_.pop_back();
+        if(!stamped(block)){
+            return false;
+        }
+        region_.free_block(block.address);
+        return check("a freed block is still a block", !region_.is_block(block.address));
+    }
+};
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[]){
+    std::size_t steps = (argc > 1) ? std::stoul(argv[1]) : 20000;
+    std::uint32_t seed = (argc > 2) ? static_cast<std::uint32_t>(std::stoul(argv[2])) : 6;
+
+    for(bool copy_on_write : {false, true}){
+        if(!Stress(seed, copy_on_write).run(steps)){
+            std::cerr << "with seed " << seed << (copy_on_write ? ", copy-on-write" : "")
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}